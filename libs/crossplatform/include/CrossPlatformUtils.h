@@ -114,6 +114,22 @@ public:
    * @return <CR><LF>
   */
   static std::string Crlf();
+
+  /**
+   * @brief Read available data from the standard input file descriptor, bypassing std::cin
+   * @param buffer buffer to read into
+   * @param size buffer size
+   * @return number of bytes read, 0 at end of input or on error
+  */
+  static size_t ReadStdin(char* buffer, size_t size);
+
+  /**
+   * @brief Write data to the standard output file descriptor, bypassing std::cout
+   * @param data data to write
+   * @param size data size
+   * @return true if all data is written
+  */
+  static bool WriteStdout(const char* data, size_t size);
 };
 
 #endif  /* CROSSPLATFORM_UTILS_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -9,6 +9,7 @@
 #include <sys/stat.h>
 #include <limits.h>
 #include <mach-o/dyld.h>
+#include <cerrno>
 #include <unistd.h>
 
  // mac specific methods
@@ -102,4 +103,29 @@ const std::string CrossPlatformUtils::PopenCmd(const std::string& cmd) {
   return cmd;
 }
 
+size_t CrossPlatformUtils::ReadStdin(char* buffer, size_t size)
+{
+  ssize_t bytesRead;
+  do {
+    bytesRead = ::read(STDIN_FILENO, buffer, size);
+  } while (bytesRead < 0 && errno == EINTR);
+  return bytesRead > 0 ? (size_t)bytesRead : 0;
+}
+
+bool CrossPlatformUtils::WriteStdout(const char* data, size_t size)
+{
+  while (size > 0) {
+    ssize_t written = ::write(STDOUT_FILENO, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += written;
+    size -= (size_t)written;
+  }
+  return true;
+}
+
 // end of Utils.cpp
@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2020-2022 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 #include "CrossPlatformUtils.h"
 
 #include <cassert>
+#include <cstdio>
 #include <limits.h>
 #include <windows.h>
 #include <io.h>
@@ -168,4 +169,23 @@ const std::string CrossPlatformUtils::PopenCmd(const std::string& cmd) {
   return "\"" + cmd + "\"";
 }
 
+size_t CrossPlatformUtils::ReadStdin(char* buffer, size_t size)
+{
+  int bytesRead = ::_read(_fileno(stdin), buffer, (unsigned int)(size < INT_MAX ? size : INT_MAX));
+  return bytesRead > 0 ? (size_t)bytesRead : 0;
+}
+
+bool CrossPlatformUtils::WriteStdout(const char* data, size_t size)
+{
+  while (size > 0) {
+    int written = ::_write(_fileno(stdout), data, (unsigned int)(size < INT_MAX ? size : INT_MAX));
+    if (written < 0) {
+      return false;
+    }
+    data += written;
+    size -= (size_t)written;
+  }
+  return true;
+}
+
 // end of Utils.cpp
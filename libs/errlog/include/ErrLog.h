@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -13,6 +13,7 @@
 #include <string>
 #include <map>
 #include <list>
+#include <mutex>
 #include <set>
 
 
@@ -223,17 +224,30 @@ public:
 
   /**
    * @brief get current message consumer (redirection of messages)
-   * @return current message consumer
+   * @return consumer set for the calling thread if any, otherwise the process-wide one
   */
-  IErrConsumer* GetErrConsumer() const { return m_ErrConsumer; }
+  IErrConsumer* GetErrConsumer() const { return m_threadErrConsumer ? m_threadErrConsumer : m_ErrConsumer; }
 
   /**
-   * @brief set a new message consumer (redirection of messages)
+   * @brief set a new process-wide message consumer (redirection of messages)
    * @param errConsumer new message consumer
    * @return previous message consumer
   */
   IErrConsumer* SetErrConsumer(IErrConsumer* errConsumer);
 
+  /**
+   * @brief get message consumer set for the calling thread
+   * @return message consumer or nullptr if the process-wide one is used
+  */
+  IErrConsumer* GetThreadErrConsumer() const { return m_threadErrConsumer; }
+
+  /**
+   * @brief set a message consumer for the calling thread, it takes precedence over the process-wide one
+   * @param errConsumer new message consumer, nullptr to use the process-wide one
+   * @return previous message consumer of the calling thread
+  */
+  IErrConsumer* SetThreadErrConsumer(IErrConsumer* errConsumer);
+
   /**
    * @brief get current message sink
    * @return  current message sink
@@ -383,7 +397,7 @@ public:
   void          SetLevelToError       ()                                { SetLevel(MsgLevel::LEVEL_ERROR);          }
 
   /**
-   * @brief sets the name of the currently processed file
+   * @brief sets the name of the file currently processed by the calling thread
    * @param fileName the name of the currently processed file
   */
   void          SetFileName           (const std::string &fileName)     { m_fileName = fileName;                    }
@@ -504,6 +518,7 @@ public:
 protected:
   char*                   m_outBuf;
   IErrConsumer*           m_ErrConsumer;     // not deleted in destructor
+  static thread_local IErrConsumer* m_threadErrConsumer; // not deleted in destructor, set per thread
   ErrOutputter*           m_ErrOutputter;    // gets deleted in destructor!
 
   bool                    m_quietMode;
@@ -511,7 +526,7 @@ protected:
 
   MsgLevel                m_msgOutLevel;
   bool                    m_tmpLevelVerbose;
-  std::string             m_fileName;
+  static thread_local std::string m_fileName; // set per thread
   int                     m_errCnt;
   int                     m_warnCnt;
   std::set<std::string>   m_diagSuppressMsg;
@@ -524,6 +539,8 @@ protected:
   bool                  m_bSuppressAllError;
   bool                  m_allowSuppressError;
 
+  std::recursive_mutex  m_mutex; // serializes message output from concurrent threads
+
 private:
   class ErrLogDestroyer {
   public:
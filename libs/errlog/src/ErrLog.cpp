@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -16,6 +16,8 @@ const string ErrLog::NEW_LINE_STRING = "\n";
 
 ErrLog::ErrLogDestroyer ErrLog::theErrLogDestroyer;
 ErrLog* ErrLog::theErrLog = nullptr;  // the application-wide ErrLog Object
+thread_local IErrConsumer* ErrLog::m_threadErrConsumer = nullptr;
+thread_local string ErrLog::m_fileName;
 MsgTable PdscMsg::m_messageTable;
 MsgTableStrict PdscMsg::m_messageTableStrict;
 MsgLevel g_msgLevel;
@@ -188,12 +190,21 @@ void ErrLog::InitMessageTable()
 
 IErrConsumer* ErrLog::SetErrConsumer(IErrConsumer* errConsumer)
 {
+  lock_guard<recursive_mutex> lock(m_mutex);
   IErrConsumer* prev = m_ErrConsumer;
   m_ErrConsumer = errConsumer;
 
   return prev;
 }
 
+IErrConsumer* ErrLog::SetThreadErrConsumer(IErrConsumer* errConsumer)
+{
+  IErrConsumer* prev = m_threadErrConsumer;
+  m_threadErrConsumer = errConsumer;
+
+  return prev;
+}
+
 ErrOutputter* ErrLog::SetOutputter(ErrOutputter* errOutputter)
 {
   ErrOutputter* prev = m_ErrOutputter;
@@ -508,6 +519,7 @@ void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
 {
   static int prevWasMsg = 0, prevSuppressed = 0;
 
+  lock_guard<recursive_mutex> lock(m_mutex);
   MsgLevel msgLevel = msg.GetMsgLevel ();
   g_msgLevel = msgLevel;
 
@@ -543,7 +555,8 @@ void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
     return;
   }
 
-  if (m_ErrConsumer && m_ErrConsumer->Consume(msg, m_fileName)) {
+  IErrConsumer* errConsumer = GetErrConsumer();
+  if (errConsumer && errConsumer->Consume(msg, m_fileName)) {
     return;
   }
 
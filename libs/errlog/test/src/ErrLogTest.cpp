@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -13,6 +13,7 @@
 #include <vector>
 #include <list>
 #include <string>
+#include <thread>
 
 using namespace std;
 
@@ -110,3 +111,41 @@ TEST_F(ErrLogTest, PdscMessage) {
   ErrLog::Get()->Save();
   ErrLog::Get()->ClearLogMessages();
 }
+
+class ErrLogTestConsumer : public IErrConsumer
+{
+public:
+  bool Consume(const PdscMsg& msg, const std::string& fileName) override {
+    m_files.push_back(fileName);
+    return true;
+  }
+  list<string> m_files;
+};
+
+TEST_F(ErrLogTest, ErrConsumer) {
+  ErrLogTestConsumer processConsumer, threadConsumer;
+  ErrLog::Get()->ClearLogMessages();
+  EXPECT_TRUE(ErrLog::Get()->SetErrConsumer(&processConsumer) == nullptr);
+  ErrLog::Get()->SetFileName("main.test");
+
+  // process-wide consumer receives messages of other threads with their own file name
+  thread worker([&]() {
+    ErrLog::Get()->SetFileName("worker.test");
+    LogMsg("M001", 1, 0);
+    // thread consumer is used by the calling thread only
+    EXPECT_TRUE(ErrLog::Get()->SetThreadErrConsumer(&threadConsumer) == nullptr);
+    LogMsg("M001", 2, 0);
+    EXPECT_TRUE(ErrLog::Get()->SetThreadErrConsumer(nullptr) == &threadConsumer);
+    ErrLog::Get()->SetFileName("");
+  });
+  worker.join();
+  LogMsg("M001", 3, 0);
+
+  EXPECT_EQ(processConsumer.m_files, list<string>({ "worker.test", "main.test" }));
+  EXPECT_EQ(threadConsumer.m_files, list<string>({ "worker.test" }));
+  EXPECT_TRUE(ErrLog::Get()->GetLogMessages().empty());
+
+  EXPECT_TRUE(ErrLog::Get()->SetErrConsumer(nullptr) == &processConsumer);
+  ErrLog::Get()->SetFileName("");
+  ErrLog::Get()->ClearLogMessages();
+}
@@ -369,6 +369,14 @@ public:
   */
   static std::string CreateExtendedName(const std::string& path, const std::string& extPrefix);  // creates a name "<path>_<extPrefix>_<index>
 
+  /**
+   * @brief create a name for a temporary file next to the given one, e.g. to write it and rename afterwards.
+   *        The name contains a random suffix, so concurrent threads and processes do not use the same name
+   * @param path path of the target file
+   * @return string according to the syntax <path>.<random hex>.tmp
+  */
+  static std::string CreateTemporaryName(const std::string& path);
+
   /**
    * @brief find file using regular expression
    * @param search paths
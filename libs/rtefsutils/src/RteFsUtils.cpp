@@ -24,6 +24,7 @@
 #include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <random>
 #include <regex>
 #include <thread>
 
@@ -806,6 +807,15 @@ string RteFsUtils::CreateExtendedName(const string& path, const string& extPrefi
   return backup;
 }
 
+string RteFsUtils::CreateTemporaryName(const string& path)
+{
+  // like mkstemp: random suffix, the generator is seeded once per thread
+  thread_local mt19937_64 generator(((uint64_t)random_device{}() << 32) ^ random_device{}());
+  stringstream ss;
+  ss << path << '.' << hex << setw(16) << setfill('0') << generator() << ".tmp";
+  return ss.str();
+}
+
 bool RteFsUtils::FindFileRegEx(const vector<string>& searchPaths, const string& regEx, string& file) {
   error_code ec;
   for (const auto& searchPath : searchPaths) {
@@ -7,6 +7,7 @@
 #include "RteUtils.h"
 #include "RteFsUtils.h"
 #include <fstream>
+#include <thread>
 
 using namespace std;
 
@@ -1184,6 +1185,21 @@ TEST_F(RteFsUtilsTest, CreateExtendedName) {
   RteFsUtils::RemoveDir(dirnameSubdir);
 }
 
+TEST_F(RteFsUtilsTest, CreateTemporaryName) {
+  const string tmp1 = RteFsUtils::CreateTemporaryName(filenameRegular);
+  const string tmp2 = RteFsUtils::CreateTemporaryName(filenameRegular);
+  EXPECT_EQ(tmp1.find(filenameRegular + "."), 0);
+  EXPECT_EQ(tmp1.rfind(".tmp"), tmp1.size() - 4);
+  EXPECT_EQ(tmp1.size(), filenameRegular.size() + 21);
+  EXPECT_NE(tmp1, tmp2);
+
+  string tmp3;
+  thread t([&tmp3, this]() { tmp3 = RteFsUtils::CreateTemporaryName(filenameRegular); });
+  t.join();
+  EXPECT_NE(tmp3, tmp1);
+  EXPECT_NE(tmp3, tmp2);
+}
+
 TEST_F(RteFsUtilsTest, AbsolutePath) {
   fs::path path;
   error_code ec;
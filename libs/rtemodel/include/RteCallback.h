@@ -40,6 +40,7 @@ static const unsigned int RTE_MB_ICONASTERISK    = 0x00000040;
 
 class RteKernel;
 class RteGenerator;
+class RteProject;
 /**
  * @brief Class to allow RTE to call application or API functions, defaults do nothing
 */
@@ -121,6 +122,14 @@ public:
   */
   virtual std::string ExpandString(const std::string& str);
 
+  /**
+   * @brief expand command or file using key sequences "@L", "%L", etc. for the given project
+   * @param str string to expand
+   * @param project pointer to RteProject providing the active target
+   * @return expanded string
+  */
+  std::string ExpandString(const std::string& str, RteProject* project);
+
   /**
    * @brief send message to the application main window by calling a function specific to OS
    * @param Msg message to send
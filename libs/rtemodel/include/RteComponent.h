@@ -15,6 +15,8 @@
 /******************************************************************************/
 #include "RteItem.h"
 
+#include <unordered_map>
+
 class RteTarget;
 class RteFileContainer;
 class RtePackage;
@@ -225,6 +227,12 @@ public:
   */
   bool Dominates(RteComponent *that) const;
 
+  /**
+   * @brief get pre-parsed component version for fast comparisons, updated by ConstructID()
+   * @return reference to VersionCmp::Key
+  */
+  const VersionCmp::Key& GetVersionKey() const { return m_versionKey; }
+
   /**
    * @brief construct name for component pre-include header file (prefix "Pre_Include")
    * @return header file name for component pre-include
@@ -243,6 +251,11 @@ protected:
    * @brief item corresponding <files> element
   */
   RteFileContainer* m_files;
+
+  /**
+   * @brief parsed component version
+  */
+  VersionCmp::Key m_versionKey;
 };
 
 /**
@@ -434,6 +447,42 @@ typedef std::map<std::string, RteComponent*> RteComponentMap;
 typedef std::map<std::string, RteComponent*, VersionCmp::Greater> RteComponentVersionMap;
 typedef std::list<RteComponent*> RteComponentList;
 
+/**
+ * @brief lookup index over a component collection keyed on Cvendor, Cclass, Cgroup, Csub and Cvariant.
+ *        Provides candidate components for attribute matching, candidates must still be checked with
+ *        RteItem::MatchComponentAttributes(). Components with wildcards in key attributes are always candidates.
+*/
+class RteComponentIndex
+{
+public:
+  /**
+   * @brief clear the index
+  */
+  void Clear();
+
+  /**
+   * @brief build the index
+   * @param components map of component ID to RteComponent pointer, map order is preserved in candidate lists
+  */
+  void Build(const RteComponentMap& components);
+
+  /**
+   * @brief collect candidate components for given attributes
+   * @param attributes component attributes to match
+   * @param candidates vector to fill with candidates in original order
+  */
+  void GetCandidates(const XmlAttributes& attributes, std::vector<RteComponent*>& candidates) const;
+
+protected:
+  static std::string GetKey(const XmlAttributes& attributes);
+  void Collect(const std::vector<size_t>* bucket, std::vector<RteComponent*>& candidates) const;
+
+  std::vector<RteComponent*> m_components;
+  std::unordered_map<std::string, std::vector<size_t> > m_keyBuckets; // full key to component positions
+  std::unordered_map<std::string, std::vector<size_t> > m_classBuckets; // Cclass to component positions
+  std::vector<size_t> m_patterns; // positions of components with wildcards in key attributes
+};
+
 /**
  * @brief class that aggregates different component variants and versions in one selectable entity.
 */
@@ -638,7 +687,7 @@ public:
    * @param bRespectVersion flag to consider Cversion and Capiversion attributes, default is true
    * @return true if at least one component has all attributes found in the supplied map
   */
-  bool MatchComponentAttributes(const std::map<std::string, std::string>& attributes, bool bRespectVersion = true) const override;
+  bool MatchComponentAttributes(const XmlAttributes& attributes, bool bRespectVersion = true) const override;
 
   /**
    * @brief get short component aggregate display name to use in a tree view
@@ -698,7 +747,7 @@ public:
    * @param attributes std::map with attributes to match
    * @return pointer to RteComponent if found, nullptr otherwise
   */
-  RteComponent* FindComponent(const std::map<std::string, std::string>& attributes) const;
+  RteComponent* FindComponent(const XmlAttributes& attributes) const;
 
   /**
    * @brief get RteComponent with the latest version available for specified variant
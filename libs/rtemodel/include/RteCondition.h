@@ -8,13 +8,20 @@
 */
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 /******************************************************************************/
 #include "RteItem.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 class RteTarget;
 class RteCondition;
 class RteComponent;
@@ -197,7 +204,29 @@ protected:
   bool HasDepsResult(std::map<const RteItem*, RteDependencyResult>& results) const;
 
 protected:
+  /**
+   * @brief compile attribute checks into a flat list of predicates, called from ConstructID(),
+   *        predicates keep copies of attribute names and values and do not depend on the attribute storage
+  */
+  void CompilePredicates();
+
+  /**
+   * @brief single attribute check against target attributes
+  */
+  struct Predicate {
+    enum Kind {
+      MATCH,  // wildcard match
+      VENDOR, // device vendor match
+      MASK    // bitmask intersection (Dcdecp)
+    };
+    std::string m_name;
+    std::string m_value;
+    Kind m_kind;
+    unsigned long m_mask;
+  };
+
   char m_domain; // expression domain
+  std::vector<Predicate> m_predicates; // compiled attribute checks for device, board and toolchain expressions
 
 public:
   static const std::string ACCEPT_TAG;
@@ -321,6 +350,16 @@ public:
    std::string GetDisplayName() const override;
 
 public:
+  /**
+   * @brief clear condition, deletes child expressions
+  */
+   void Clear() override;
+
+  /**
+   * @brief construct condition after children are created, collects child expressions
+  */
+   void Construct() override;
+
   /**
    * @brief validate condition after construction
    * @return true if all child expressions are valid and no recursion is detected
@@ -361,6 +400,12 @@ public:
   */
    ConditionResult GetConditionResult(RteConditionContext* context) const override;
 
+  /**
+   * @brief get child expressions collected by Construct()
+   * @return vector of RteConditionExpression pointers in document order
+  */
+  const std::vector<RteConditionExpression*>& GetExpressions() const { return m_expressions; }
+
    /**
     * @brief get static verbosity flags
     * @return verbosity flags as unsigned integer
@@ -409,10 +454,10 @@ protected:
   void SetEvaluating(RteConditionContext* context, bool evaluating);
 
 private:
-  int m_bDeviceDependent; // cached device dependency flag
-  int m_bBoardDependent; // cached board dependency flag
+  std::atomic<int> m_bDeviceDependent; // cached device dependency flag, calculated once on demand
+  std::atomic<int> m_bBoardDependent; // cached board dependency flag, calculated once on demand
   bool m_bInCheck; // recursion protection flag for CalcDeviceAndBoardDependentFlags() and  ValidateRecursion()
-  std::set<RteConditionContext*> m_evaluating; // recursion protection for Evaluate(RteConditionContext*)
+  std::vector<RteConditionExpression*> m_expressions; // child expressions, avoids casting children on every evaluation
   static unsigned s_uVerboseFlags;
 };
 
@@ -578,6 +623,61 @@ private:
   std::map<const RteItem*, RteDependencyResult> m_results; // sub-items (condition expression)
 };
 
+/**
+ * @brief cache of filter condition results shared between targets with identical filter attributes.
+ *        Filtering results only depend on an evaluated item and on target attributes,
+ *        therefore targets with equal attributes can reuse each other's results.
+*/
+class RteConditionResultCache
+{
+public:
+  /**
+   * @brief thread-safe collection of results for one set of filter attributes
+  */
+  class Results
+  {
+  public:
+    /**
+     * @brief get cached result for specified item
+     * @param item pointer to RteItem to search for
+     * @return cached RteItem::ConditionResult, RteItem::UNDEFINED if not found
+    */
+    RteItem::ConditionResult Get(RteItem* item) const;
+
+    /**
+     * @brief cache result for specified item
+     * @param item pointer to RteItem
+     * @param res RteItem::ConditionResult to cache
+    */
+    void Set(RteItem* item, RteItem::ConditionResult res);
+
+    /**
+     * @brief remove all cached results
+    */
+    void Clear();
+
+  private:
+    mutable std::mutex m_mutex;
+    std::unordered_map<RteItem*, RteItem::ConditionResult> m_results;
+  };
+
+  /**
+   * @brief get results for given filter attributes, create empty collection if not yet exists
+   * @param attributes filter attributes of a target
+   * @return pointer to Results, remains valid as long as this cache
+  */
+  Results* GetResults(const XmlAttributes& attributes);
+
+  /**
+   * @brief clear all cached results, must be called when conditions get deleted or replaced
+  */
+  void Clear();
+
+private:
+  std::mutex m_mutex;
+  std::unordered_map<std::string, std::unique_ptr<Results> > m_results; // attribute key to results
+};
+
 /**
  * @brief base class to provide context for condition evaluation: filtering (this base) or resolving component dependencies (derived class)
 */
@@ -620,10 +720,30 @@ public:
   RteItem::ConditionResult GetConditionResult(RteItem* item) const; // returns cached result
 
   /**
-   * @brief clear internal data and caches
+   * @brief clear internal data and caches, detaches shared results
   */
   virtual void Clear();
 
+  /**
+   * @brief attach results shared with other contexts, they are consulted and updated in addition to own cache
+   * @param sharedResults pointer to RteConditionResultCache::Results, nullptr to detach
+  */
+  void SetSharedResults(RteConditionResultCache::Results* sharedResults) { m_sharedResults = sharedResults; }
+
+  /**
+   * @brief check if a condition is being evaluated in this context (recursion protection)
+   * @param condition pointer to RteCondition
+   * @return true if condition is being evaluated
+  */
+  bool IsEvaluating(const RteCondition* condition) const { return m_evaluating.find(condition) != m_evaluating.end(); }
+
+  /**
+   * @brief set if a condition is under evaluation in this context (recursion protection)
+   * @param condition pointer to RteCondition
+   * @param evaluating true before evaluating, false after evaluating
+  */
+  void SetEvaluating(const RteCondition* condition, bool evaluating);
+
   /**
    * @brief check if this context is verbose
   */
@@ -657,12 +777,16 @@ protected:
   RteTarget* m_target; // owning target
   RteItem::ConditionResult m_result; // overall result
   std::map<RteItem*, RteItem::ConditionResult> m_cachedResults; // collection of cached results
+  RteConditionResultCache::Results* m_sharedResults; // results shared with other contexts
+  std::set<const RteCondition*> m_evaluating; // conditions being evaluated, kept per context to evaluate shared conditions concurrently
   unsigned m_verboseIndent;
 };
 
 
 /**
- * @brief class to provide context for resolving component dependencies
+ * @brief class to provide context for resolving component dependencies.
+ * Records which component aggregates and classes each evaluated result depends on,
+ * subsequent evaluations only re-evaluate results affected by changed component selection.
 */
 class RteDependencySolver : public RteConditionContext
 {
@@ -695,6 +819,13 @@ public:
    */
    bool IsVerbose() const override;
 
+  /**
+   * @brief evaluate item if not yet done, records component aggregates and classes the result depends on
+   * @param item pointer RteItem to evaluate (RteComponent, RteFile, RteCondition, RteConditionExpression)
+   * @return result of item evaluation as RteItem::ConditionResult value
+  */
+   RteItem::ConditionResult Evaluate(RteItem* item) override;
+
   /**
   * @brief evaluate supplied condition, called from supplied condition
   * @param condition pointer to RteCondition to evaluate
@@ -717,6 +848,7 @@ public:
 
   /**
    * @brief evaluate component dependencies.
+   * Results of the previous evaluation are kept if the component selection they depend on is unchanged.
    * @return evaluation result as RteItem::ConditionResult value
   */
   RteItem::ConditionResult EvaluateDependencies();
@@ -730,6 +862,26 @@ public:
   */
   RteItem::ConditionResult ResolveDependencies();
 
+  /**
+   * @brief get revision of the last EvaluateDependencies() call
+   * @return revision, 0 if dependencies are not yet evaluated
+  */
+  size_t GetRevision() const { return m_revision; }
+
+  /**
+   * @brief check if changes since given revision are known per component aggregate
+   * @param revision revision obtained by GetRevision()
+   * @return true if revision is valid and no complete evaluation took place after it
+  */
+  bool HasChanges(size_t revision) const;
+
+  /**
+   * @brief collect selected or deselected component aggregates whose dependency results changed after given revision
+   * @param revision revision obtained by GetRevision()
+   * @return set of pointers to RteComponentAggregate
+  */
+  std::set<RteComponentAggregate*> GetChangedAggregates(size_t revision) const;
+
 protected:
   /**
    * @brief evaluate component dependencies for given expression and sores potential component aggregates
@@ -753,9 +905,63 @@ protected:
   */
   bool ResolveDependency(const RteDependencyResult& depsRes);
 
+  /**
+   * @brief selection state of a component aggregate as seen by component expressions
+  */
+  struct AggregateState {
+    int selected;
+    RteItem* component;
+    RteItem* instance;
+    bool operator==(const AggregateState& other) const {
+      return selected == other.selected && component == other.component && instance == other.instance;
+    }
+    bool operator!=(const AggregateState& other) const { return !(*this == other); }
+  };
+
+  /**
+   * @brief data an evaluated result depends on, includes data of items evaluated for it
+  */
+  struct Dependencies {
+    std::set<RteComponentAggregate*> aggregates; // matched component aggregates
+    std::set<std::string> classes; // component classes whose selected bundle limits the matches
+    std::vector<RteItem*> children; // items evaluated for this one
+    bool selection = false; // depends on all selected components, e.g. deny expressions
+    bool external = false; // evaluated outside of EvaluateDependencies()
+    void Add(RteItem* item, const Dependencies& other);
+  };
+
+  static AggregateState GetAggregateState(const RteComponentAggregate* a);
+  std::string GetClassState(const std::string& className) const;
+  std::vector<std::pair<RteComponentAggregate*, AggregateState> > GetSelectionState() const;
+  std::vector<std::pair<RteComponentAggregate*, RteItem*> > GetStructureState() const;
+
+  /**
+   * @brief remove results depending on changed component selection
+   * @return false if no incremental evaluation is possible, all results must be evaluated
+  */
+  bool InvalidateChangedResults();
+
+  /**
+   * @brief remove results not needed by selected components and store the state they depend on
+   * @param roots dependencies of the selected components
+  */
+  void UpdateIncrementalState(const Dependencies& roots);
+
+  void EraseResult(RteItem* item);
 
 protected:
   std::map<RteConditionExpression*, std::set<RteComponentAggregate*> > m_componentAggregates; // cached component aggregates per expression
+  std::map<RteItem*, Dependencies> m_dependencies; // dependencies per cached result
+  std::vector<Dependencies*> m_recording; // dependencies of items under evaluation
+  bool m_bEvaluating; // EvaluateDependencies() is running
+  bool m_bIncremental; // cached results and recorded states can be reused
+  std::map<RteComponentAggregate*, AggregateState> m_aggregateStates;
+  std::map<std::string, std::string> m_classStates;
+  std::vector<std::pair<RteComponentAggregate*, AggregateState> > m_selectionState;
+  std::vector<std::pair<RteComponentAggregate*, RteItem*> > m_structureState;
+  size_t m_revision; // incremented by each EvaluateDependencies() call
+  size_t m_fullRevision; // revision of the last complete evaluation
+  std::map<RteComponentAggregate*, size_t> m_aggregateRevisions; // revision each aggregate has changed in
 };
 
 #endif // RteCondition_H
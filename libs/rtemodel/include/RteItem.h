@@ -116,7 +116,7 @@ public:
   * @param attributes collection as key to value pairs
   * @param parent pointer to parent RteItem or nullptr if this item has no parent
  */
-  RteItem(const std::map<std::string, std::string>& attributes, RteItem* parent = nullptr);
+  RteItem(const XmlAttributes& attributes, RteItem* parent = nullptr);
 
   /**
    * @brief virtual destructor
@@ -576,7 +576,7 @@ public:
   * @param bRespectVersion flag to consider Cversion and Capiversion attributes, default is true
   * @return true if the item has all attributes found in the supplied map
   */
-  virtual bool MatchComponentAttributes(const std::map<std::string, std::string>& attributes, bool bRespectVersion = true) const;
+  virtual bool MatchComponentAttributes(const XmlAttributes& attributes, bool bRespectVersion = true) const;
 
   /**
    * @brief check if the item matches supplied API attributes
@@ -584,21 +584,21 @@ public:
    * @param bRespectVersion flag to consider Capiversion attribute, default is true
    * @return true if the item matches supplied API attributes
   */
-  virtual bool MatchApiAttributes(const std::map<std::string, std::string>& attributes, bool bRespectVersion = true) const;
+  virtual bool MatchApiAttributes(const XmlAttributes& attributes, bool bRespectVersion = true) const;
 
   /**
    * @brief check if given collection of attributes contains the same values for "Dname", "Pname" and "Dvendor"
    * @param attributes collection of attributes
    * @return true if collection of attributes contains the same values for "Dname", "Pname" and "Dvendor"
   */
-  virtual bool MatchDevice(const std::map<std::string, std::string>& attributes) const;
+  virtual bool MatchDevice(const XmlAttributes& attributes) const;
 
   /**
    * @brief check if the item matches all supplied 'D' attributes stored in the instance
    * @param attributes collection of 'D' device attributes
    * @return true if given list contains all device attributes stored in the instance
   */
-  virtual bool MatchDeviceAttributes(const std::map<std::string, std::string>& attributes) const;
+  virtual bool MatchDeviceAttributes(const XmlAttributes& attributes) const;
 
   /**
    * @brief check if attribute "maxInstances" is not empty
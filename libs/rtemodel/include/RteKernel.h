@@ -8,20 +8,24 @@
 */
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 /******************************************************************************/
 #include "RteItemBuilder.h"
 #include "RteModel.h"
+#include "RtePackIndex.h"
 #include "RteProject.h"
 #include "RteTarget.h"
 #include "RteUtils.h"
 
 #include "YmlTree.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <set>
 
 class RteCprjProject;
 class CprjFile;
@@ -211,10 +215,11 @@ public:
   virtual CprjFile* GetActiveCprjFile() const;
 
   /**
-   * @brief load and insert pack into global model
+   * @brief load and insert pack into global model,
+   *        the model is refilled if an inserted pack is modified on disk
    * @param packs list of loaded packages
    * @param pdscFiles list of packs to be loaded
-   * @return true if executed successfully
+   * @return true if executed successfully, false on error or if stopped by RteCallback::PackProcessed()
   */
   bool LoadAndInsertPacks(std::list<RtePackage*>& packs, std::list<std::string>& pdscFiles);
 
@@ -296,17 +301,80 @@ public:
   */
   RtePackage* LoadPack(const std::string& pdscFile, PackageState packState = PackageState::PS_UNKNOWN) const ;
 
+  /**
+   * @brief parse only selected elements of a pdsc file, other package children are skipped without creating items
+   * @param pdscFile pathname to scan
+   * @param scanTags tags of package child elements to read, default PACK_HEADER_TAGS
+   * @return unique_ptr to RtePackage that is not added to the pack registry, nullptr in case of errors
+  */
+  std::unique_ptr<RtePackage> ScanPack(const std::string& pdscFile, const std::set<std::string>& scanTags = PACK_HEADER_TAGS) const;
+
+  /**
+   * @brief package child elements providing pack identity and releases
+  */
+  static const std::set<std::string> PACK_HEADER_TAGS;
+
   /**
    * @brief load specified pdsc files, but does not insert them in the model
    * @param pdscFiles list of pathnames to load
    * @param packs list to receive loaded packs
    * @param model RteModel to get state and serve as parent
    * @param bReplace boolean flag to replace existing entries in the registry
-   * @return true if successful
+   * @return true if successful, false on error or if stopped by RteCallback::PackProcessed()
   */
   bool LoadPacks(const std::list<std::string>& pdscFiles, std::list<RtePackage*>& packs,
                  RteModel* model = nullptr, bool bReplace = false) const;
 
+  /**
+   * @brief set number of worker threads to parse pdsc files in LoadPacks() and LoadAndInsertPacks()
+   * @param nThreads number of threads: 0 to use hardware concurrency, 1 to parse sequentially (default)
+  */
+  void SetPackLoadThreads(unsigned nThreads) { m_packLoadThreads = nThreads; }
+
+  /**
+   * @brief get effective number of worker threads to parse pdsc files
+   * @return number of threads, at least 1
+  */
+  unsigned GetPackLoadThreads() const;
+
+  /**
+   * @brief enable or disable binary cache of parsed pdsc files in $CMSIS_PACK_ROOT/.Local/.cache
+   *        and index of installed packs in $CMSIS_PACK_ROOT/.Local/installed_packs.idx
+   * @param bEnable true to load unchanged pdsc files from the cache and find installed packs via the index,
+   *        false to always parse pdsc files and search pack directories (default)
+  */
+  void SetPackCacheEnabled(bool bEnable) { m_bPackCache = bEnable; }
+
+  /**
+   * @brief get directory of binary pdsc cache
+   * @return absolute directory name or empty string if the cache is disabled
+  */
+  std::string GetPackCacheDir() const;
+
+  /**
+   * @brief get tool version and parse options stored in pdsc cache files, files written with other ones are not used
+   * @return parser information string
+  */
+  std::string GetPackCacheParserInfo() const;
+
+  /**
+   * @brief get file name of the installed pack index
+   * @return absolute file name or empty string if the cache is disabled
+  */
+  std::string GetPackIndexFile() const;
+
+  /**
+   * @brief get index of installed packs, loads the index file or rebuilds it if pack directories have changed
+   * @return pointer to RtePackIndex or nullptr if the cache is disabled or CMSIS_PACK_ROOT is not set
+  */
+  RtePackIndex* GetPackIndex() const;
+
+  /**
+   * @brief update installed pack index with information from loaded packs and write it if changed
+   * @param packs collection of loaded packs
+  */
+  void UpdatePackIndex(const std::list<RtePackage*>& packs) const;
+
   /**
    * @brief getter for caller information (name & version)
    * @return XmlItem reference
@@ -318,7 +386,7 @@ public:
    * @param attr attributes to set as XmlItem reference
    * @return true if changed
   */
-  void SetToolInfo(const XmlItem& attr) { m_toolInfo = attr; }
+  void SetToolInfo(const XmlItem& attr) { m_toolInfo = attr; m_packCacheParserInfo.clear(); }
 
   /**
    * @brief read the latest available pack version and resolved PDSC file for each pack.
@@ -328,6 +396,47 @@ public:
   bool ReadPackLatestVerAndPath(std::map<std::string, std::pair<std::string, std::string>>& latestPacks) const;
 
 protected:
+  /**
+   * @brief result of parsing a single pdsc file
+  */
+  struct PackParseResult {
+    RtePackage* pack = nullptr;
+    bool success = false;
+    std::list<std::string> errors;
+  };
+
+  /**
+   * @brief load pdsc or gpdsc file and construct it, takes the result from the supplied collection if the file is already parsed
+   * @param pdscFile pathname to load
+   * @param packState PackageState to assign to a loaded pack
+   * @param parsedPacks map of pdsc filename to PackParseResult, a used entry is removed from the map
+   * @return pointer to loaded RtePackage
+  */
+  RtePackage* LoadPack(const std::string& pdscFile, PackageState packState, std::map<std::string, PackParseResult>& parsedPacks) const;
+
+  /**
+   * @brief parse single pdsc or gpdsc file without adding it to the pack registry
+   * @param pdscFile pathname to parse
+   * @param rootParent pointer to RteItem to be parent for the created pack
+   * @param packState PackageState to assign to the created pack
+   * @param result PackParseResult to fill
+  */
+  void ParsePack(const std::string& pdscFile, RteItem* rootParent, PackageState packState, PackParseResult& result) const;
+
+  /**
+   * @brief limit size of the pack cache directory if cache files were written since the last call
+  */
+  void PrunePackCache() const;
+
+  /**
+   * @brief parse pdsc files concurrently using GetPackLoadThreads() workers, each file is parsed with own XMLTree and RteItemBuilder
+   * @param pdscFiles vector of pairs of pathname and PackageState, must not contain duplicates
+   * @param rootParent pointer to RteItem to be parent for the created packs
+   * @param parsedPacks map of pdsc filename to PackParseResult to fill, packs are not added to the pack registry
+  */
+  void ParsePacks(const std::vector<std::pair<std::string, PackageState> >& pdscFiles, RteItem* rootParent,
+                  std::map<std::string, PackParseResult>& parsedPacks) const;
+
   /**
    * @brief get local pdsc files, optionally filtered
    * @param attr pack attributes to filter
@@ -384,6 +493,14 @@ protected:
   std::string m_cmsisToolboxDir;
   std::map<std::string, RteItem*> m_externalGeneratorFiles;
   std::map<std::string, RteGenerator*> m_externalGenerators;
+  unsigned m_packLoadThreads;
+  bool m_bPackCache;
+  mutable std::string m_packCacheParserInfo;      // created on first use under m_xmlTreeMutex
+  mutable std::atomic<bool> m_bPackCacheWritten;  // cache files are written since the cache was pruned
+  mutable std::atomic<bool> m_bPackCacheReadOnly; // no cache files are written after a failed write
+  mutable std::unique_ptr<RtePackIndex> m_packIndex;
+  mutable std::mutex m_packIndexMutex;
+  mutable std::mutex m_xmlTreeMutex; // XMLTree creation registers message tables and must not run concurrently
 
 };
 #endif // RteKernel_H
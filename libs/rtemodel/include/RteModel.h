@@ -25,6 +25,9 @@
 #include "RteBoard.h"
 #include "RteGenerator.h"
 
+#include <unordered_map>
+#include <vector>
+
 class RteComponentGroup;
 class RteProject;
 
@@ -181,6 +184,14 @@ public:
   */
   RteBoard* FindBoard(const std::string& displayName) const;
 
+  /**
+   * @brief collect boards matching given name pattern and vendor
+   * @param boards collection of boards to fill, sorted in the same way as GetBoards()
+   * @param namePattern board display name or wild card pattern, empty to collect all boards
+   * @param vendor board vendor name, empty to collect boards of any vendor
+  */
+  void GetBoards(std::list<RteBoard*>& boards, const std::string& namePattern, const std::string& vendor) const;
+
   /**
    * @brief find compatible board given by display name and device
    * @param displayName given display name
@@ -244,7 +255,7 @@ public:
    * @param componentAttributes given component attributes
    * @return RteApi pointer
   */
-  RteApi* GetApi(const std::map<std::string, std::string>& componentAttributes) const;
+  RteApi* GetApi(const XmlAttributes& componentAttributes) const;
 
   /**
    * @brief getter for api by given api ID
@@ -502,6 +513,12 @@ public:
   */
   void SetFilterContext(RteConditionContext* filterContext) { m_filterContext = filterContext; }
 
+  /**
+   * @brief getter for filter condition results shared between targets using this model
+   * @return reference to RteConditionResultCache
+  */
+  RteConditionResultCache& GetConditionResultCache() { return m_conditionResultCache; }
+
   /**
    * @brief check if supplied item passes current filter context
    * @param item RteItem to check
@@ -550,6 +567,7 @@ protected:
 
   virtual void FillDeviceTree();
   virtual void FillDeviceTree(RtePackage* pack);
+  void UpdateDeviceIndex();
 
   void AddPackItemsToList(const Collection<RteItem*>& srcCollection, Collection<RteItem*>& dstCollection, const std::string& tag);
 
@@ -575,6 +593,40 @@ protected:
   // boards
   RteBoardMap m_boards;
 
+  /**
+   * @brief name-sorted lookup array for wild card queries
+  */
+  struct NameIndex {
+    struct Entry {
+      std::string name;
+      size_t order; // position in the original collection
+      std::string vendor;
+      RteDeviceItem::TYPE type;
+      RteItem* item;
+    };
+    std::vector<Entry> entries;
+    bool bNamePatterns = false; // names contain wild cards, prefix search is not applicable to symmetric match
+
+    void Clear();
+    void Add(const std::string& name, const std::string& vendor, RteDeviceItem::TYPE type, RteItem* item);
+    void Sort();
+    /**
+     * @brief find entries matching given pattern
+     * @param pattern wild card pattern or name, empty to find all entries
+     * @param bSymmetric true to use WildCards::Match(), false to use WildCards::MatchToPattern()
+     * @param found collection of entries to fill sorted by order
+    */
+    void Find(const std::string& pattern, bool bSymmetric, std::vector<const Entry*>& found) const;
+  };
+
+  // lookup indices rebuilt by FillDeviceTree(), results are the same as of the searches they replace
+  std::unordered_map<std::string, std::pair<size_t, RteDevice*> > m_deviceIndex; // full device name to vendor rank and device
+  RteDeviceItemAggregateMap m_deviceAggregateIndex; // device name to aggregate found by hierarchical search in device tree
+  std::map<std::string, RteDeviceItemAggregateMap, AlnumCmp::LenLessNoCase> m_vendorDeviceAggregateIndex; // the same per vendor
+  NameIndex m_deviceNames; // devices in device tree traversal order
+  std::unordered_map<std::string, RteBoard*> m_boardIndex; // board display name to board
+  NameIndex m_boardNames; // boards in order of m_boards
+
   // packs
   RtePackageMap m_packages; // sorted package map (full id to package, latest versions first)
   RtePackageMap m_latestPackages; // latests packages (common id to package)
@@ -586,6 +638,7 @@ protected:
   Collection<RteItem*> m_templateDescriptors;
 
   RteConditionContext* m_filterContext; // constructed, updated and deleted by target
+  RteConditionResultCache m_conditionResultCache; // filter results shared between targets
 
   std::string m_rtePath; // path to RTEPATH from tools.ini
 };
@@ -612,7 +665,7 @@ public:
    void Clear() override;
 
   /**
-   * @brief clean up all project targets and CMSIS RTE data model
+   * @brief clean up all project targets and CMSIS RTE data model, start a new attribute string pool
   */
    void ClearModel() override;
 
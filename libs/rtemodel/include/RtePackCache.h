@@ -0,0 +1,141 @@
+#ifndef RtePackCache_H
+#define RtePackCache_H
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RtePackCache.h
+* @brief CMSIS RTE Data Model : binary cache of parsed pdsc files
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2025-2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "IXmlItemBuilder.h"
+
+#include <string>
+#include <cstdint>
+#include <filesystem>
+
+/**
+ * @brief item builder that forwards all calls to another builder and records them in a compact binary stream
+*/
+class RtePackCacheRecorder : public IXmlItemBuilder
+{
+public:
+  /**
+   * @brief constructor
+   * @param builder pointer to IXmlItemBuilder to forward calls to
+  */
+  RtePackCacheRecorder(IXmlItemBuilder* builder) : m_builder(builder) {}
+
+  /**
+   * @brief get recorded stream
+   * @return binary string with recorded builder calls
+  */
+  const std::string& GetStream() const { return m_stream; }
+
+  void Clear(bool bDeleteContent = false) override;
+  void SetFileName(const std::string& fileName) override;
+  bool CreateItem(const std::string& tag) override;
+  bool HasRoot() const override { return m_builder->HasRoot(); }
+  void AddItem() override;
+  void AddAttribute(const std::string& key, const std::string& value) override;
+  void SetText(const std::string& text) override;
+  void PreCreateItem() override;
+  void PostCreateItem(bool success) override;
+  void SetLineNumber(int lineNumber) override;
+
+protected:
+  IXmlItemBuilder* m_builder;
+  std::string m_stream;
+};
+
+/**
+ * @brief class to store and restore recorded item builder calls for pdsc files in a cache directory
+*/
+class RtePackCache
+{
+public:
+  /**
+   * @brief default limit for the total size of cache files
+  */
+  static constexpr uint64_t DEFAULT_MAX_SIZE = 256ULL * 1024 * 1024;
+
+  /**
+   * @brief constructor
+   * @param cacheDir directory to store cache files
+   * @param parserInfo tool version and parse options, cache files written with other ones are not used
+  */
+  RtePackCache(const std::string& cacheDir, const std::string& parserInfo = std::string()) :
+    m_cacheDir(cacheDir), m_parserInfo(parserInfo) {}
+
+  /**
+   * @brief get cache directory
+   * @return cache directory
+  */
+  const std::string& GetCacheDir() const { return m_cacheDir; }
+
+  /**
+   * @brief get tool version and parse options the cache files are written for
+   * @return parser information string
+  */
+  const std::string& GetParserInfo() const { return m_parserInfo; }
+
+  /**
+   * @brief get cache file name for a pdsc file
+   * @param pdscFile absolute pdsc filename
+   * @return absolute cache filename
+  */
+  std::string GetCacheFileName(const std::string& pdscFile) const;
+
+  /**
+   * @brief replay cached builder calls if cache file exists and pdsc file is unchanged
+   * @param pdscFile absolute pdsc filename
+   * @param builder pointer to IXmlItemBuilder to replay calls to
+   * @return true if items are created from the cache, false if pdsc file must be parsed
+  */
+  bool Load(const std::string& pdscFile, IXmlItemBuilder* builder) const;
+
+  /**
+   * @brief write recorded builder calls to cache file
+   * @param pdscFile absolute pdsc filename
+   * @param fileTime pdsc modification time obtained before the file was parsed, nothing is written if the file has changed since
+   * @param recorder RtePackCacheRecorder used to parse the pdsc file
+   * @return true if successful
+  */
+  bool Save(const std::string& pdscFile, const std::filesystem::file_time_type& fileTime,
+    const RtePackCacheRecorder& recorder) const;
+
+  /**
+   * @brief remove unreadable cache files and those of pdsc files that no longer exist,
+   *        then remove the least recently written files until the total size does not exceed the limit
+   * @param maxSize maximum total size of cache files in bytes
+  */
+  void Prune(uint64_t maxSize = DEFAULT_MAX_SIZE) const;
+
+  /**
+   * @brief calculate 64-bit FNV-1a hash of a buffer
+   * @param buffer string to calculate hash for
+   * @return hash value
+  */
+  static uint64_t CalcHash(const std::string& buffer);
+
+  /**
+   * @brief calculate size and 64-bit FNV-1a hash of a file, reading it with the mapped file reader used by the parser
+   * @param fileName file to calculate hash for
+   * @param size returns file size
+   * @param hash returns hash value
+   * @return true if successful
+  */
+  static bool CalcFileHash(const std::string& fileName, uint64_t& size, uint64_t& hash);
+
+protected:
+  std::string m_cacheDir;
+  std::string m_parserInfo;
+};
+
+#endif // RtePackCache_H
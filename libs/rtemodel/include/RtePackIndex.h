@@ -0,0 +1,126 @@
+#ifndef RtePackIndex_H
+#define RtePackIndex_H
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RtePackIndex.h
+* @brief CMSIS RTE Data Model : persistent index of packs installed in CMSIS_PACK_ROOT
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class RtePackage;
+
+/**
+ * @brief index of installed pdsc files with pack identity.
+ *        The index records modification times of the directories visited to find pdsc files,
+ *        it stays valid as long as no pack, pack version or vendor directory is added or removed.
+*/
+class RtePackIndex
+{
+public:
+  /**
+   * @brief indexed pdsc file
+  */
+  struct Entry {
+    std::string pdscFile;          // absolute pdsc filename
+    std::string id;                // pack ID: from the file path, from pack attributes once the pack is loaded
+    int64_t pdscTime = 0;          // pdsc modification time when the pack was loaded
+    bool bLoaded = false;          // id is taken from the loaded pack
+  };
+
+  /**
+   * @brief constructor
+   * @param packRoot pack root directory
+  */
+  RtePackIndex(const std::string& packRoot);
+
+  /**
+   * @brief get pack root directory
+   * @return pack root directory
+  */
+  const std::string& GetPackRoot() const { return m_packRoot; }
+
+  /**
+   * @brief get indexed pdsc files
+   * @return vector of Entry in the order the files are found in the pack root
+  */
+  const std::vector<Entry>& GetEntries() const { return m_entries; }
+
+  /**
+   * @brief get entry for a pdsc file
+   * @param pdscFile absolute pdsc filename
+   * @return pointer to Entry or nullptr if the file is not indexed
+  */
+  const Entry* GetEntry(const std::string& pdscFile) const;
+
+  /**
+   * @brief check if an entry describes the current pdsc file
+   * @param e Entry to check
+   * @return true if the entry is taken from a loaded pack and the pdsc file is not modified since
+  */
+  static bool IsCurrent(const Entry& e);
+
+  /**
+   * @brief check if the index has unsaved changes
+   * @return true if modified since last Load(), Save() or Scan()
+  */
+  bool IsModified() const { return m_bModified; }
+
+  /**
+   * @brief check if recorded directory times are still actual
+   * @return true if the index is not empty and no recorded directory has changed
+  */
+  bool IsValid() const;
+
+  /**
+   * @brief rebuild index by searching pdsc files in the pack root the same way as RteFsUtils::GetPackageDescriptionFiles() with depth 3,
+   *        information of loaded packs is kept for files found again unmodified
+  */
+  void Scan();
+
+  /**
+   * @brief update entry with information from a loaded pack
+   * @param pack pointer to RtePackage
+   * @return true if the entry is changed
+  */
+  bool UpdateEntry(RtePackage* pack);
+
+  /**
+   * @brief read index file
+   * @param indexFile absolute index filename
+   * @return true if successful and the file is written for the same pack root
+  */
+  bool Load(const std::string& indexFile);
+
+  /**
+   * @brief write index file
+   * @param indexFile absolute index filename
+   * @return true if successful
+  */
+  bool Save(const std::string& indexFile);
+
+protected:
+  void Clear();
+  void ScanDir(const std::string& dir, int depth, std::vector<Entry>& entries);
+  Entry& AddEntry(const std::string& pdscFile, std::vector<Entry>& entries);
+
+  std::string m_packRoot;
+  std::vector<Entry> m_entries;
+  std::unordered_map<std::string, size_t> m_entryIndex; // pdsc file to position in m_entries
+  std::map<std::string, int64_t> m_dirTimes;            // visited directory to its modification time
+  bool m_bModified;
+};
+
+#endif // RtePackIndex_H
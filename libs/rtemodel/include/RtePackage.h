@@ -22,6 +22,7 @@ class RteTarget;
 class RtePackage;
 class RtePackageAggregate;
 class RtePackageComparator;
+class RteConditionResultCache;
 class RteExample;
 class RteGeneratorContainer;
 class RteGeneratorProject;
@@ -120,6 +121,14 @@ public:
   */
   static std::string VersionFromId(const std::string& id);
 
+  /**
+   * @brief helper static method to get pack version from its ID without copying if possible
+   * @param id pack ID
+   * @param buf string buffer to keep version if it must be converted to semantic version
+   * @return view of the version string in id or buf
+  */
+  static std::string_view VersionViewFromId(const std::string& id, std::string& buf);
+
   /**
    * @brief helper static method to extract release version from pack ID
    * @param id full pack ID
@@ -287,7 +296,7 @@ public:
    * @param componentAttributes given component attributes
    * @return RteApi pointer
   */
-  RteApi* GetApi(const std::map<std::string, std::string>& componentAttributes) const;
+  RteApi* GetApi(const XmlAttributes& componentAttributes) const;
 
   /**
    * @brief getter for api by given api ID
@@ -602,6 +611,12 @@ public:
   */
   virtual bool IsDominating() const;
 
+  /**
+   * @brief get pre-parsed pack version for fast comparisons, updated by ConstructID()
+   * @return reference to VersionCmp::Key
+  */
+  const VersionCmp::Key& GetVersionKey() const { return m_versionKey; }
+
   /**
    * @brief check if the pack is generated by a program associated with an RteGenerator object
    * @return true if package state is PackageState::PS_GENERATED
@@ -665,6 +680,7 @@ private:
 
   std::set<std::string> m_keywords; // collected keyword
   std::string m_commonID; // common or 'family' pack ID
+  VersionCmp::Key m_versionKey; // parsed "version" attribute value
 };
 
 /**
@@ -1365,12 +1381,25 @@ public:
   */
   void ClearPdscMap() { m_pdscMap.clear(); }
 
+  /**
+   * @brief set condition result cache to clear when packs get deleted
+   * @param cache pointer to RteConditionResultCache, results are keyed by items of the packs
+  */
+  void SetConditionResultCache(RteConditionResultCache* cache) { m_conditionResultCache = cache; }
+
 protected:
+  void ClearConditionResults();
+
   /**
    * @brief collection of loaded packs: absolute pdsc filename -> RtePackage*
   */
   std::map<std::string, RtePackage*> m_loadedPacks;
 
+  /**
+   * @brief cached condition results referring to items of loaded packs
+  */
+  RteConditionResultCache* m_conditionResultCache;
+
   /**
    * @brief collection of effective pdscs: lower-case pack id -> absolute pdsc filename
   */
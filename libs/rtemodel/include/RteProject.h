@@ -645,7 +645,7 @@ public:
    * @param componentAttributes list of component attributes to match
    * @return RteComponentInstance pointer
   */
-  RteComponentInstance* GetApiInstance(const std::map<std::string, std::string>& componentAttributes) const;
+  RteComponentInstance* GetApiInstance(const XmlAttributes& componentAttributes) const;
 
   /**
    * @brief get CMSIS RTE data model specific to this project
@@ -287,7 +287,7 @@ public:
    * @param componentAttributes list of attributes of a component
    * @return pointer to an instance of type RteApi
   */
-  RteApi* GetApi(const std::map<std::string, std::string>& componentAttributes) const;
+  RteApi* GetApi(const XmlAttributes& componentAttributes) const;
 
   /**
    * @brief getter for RteApi instance determined by an api ID
@@ -311,7 +311,7 @@ public:
    * @param components list of components to be filled
    * @return status of component dependency of type ConditionResult
   */
-  ConditionResult GetComponents(const std::map<std::string, std::string>& componentAttributes, std::set<RteComponent*>& components) const;
+  ConditionResult GetComponents(const XmlAttributes& componentAttributes, std::set<RteComponent*>& components) const;
 
   /**
    * @brief getter for a collection of RteComponentAggregates which match the given component attributes
@@ -590,7 +590,7 @@ public:
 
 protected:
   void CollectSelectedComponentAggregates(std::map<RteComponentAggregate*, int>& selectedAggregates) const;
-  ConditionResult GetComponentsForApi(RteApi* api, const std::map<std::string, std::string>& componentAttributes, std::set<RteComponent*>& components, bool selectedOnly) const;
+  ConditionResult GetComponentsForApi(RteApi* api, const XmlAttributes& componentAttributes, std::set<RteComponent*>& components, bool selectedOnly) const;
   static void GetSpecificBundledClasses(const std::map<RteComponentAggregate*, int>& aggregates, std::map<std::string, std::string>& specificClasses);
 
   void FilterComponents();
@@ -1054,6 +1054,7 @@ protected:
 
   bool m_bTargetSupported; // target is supported by RTE, can only be defined from outside
   RteComponentMap m_filteredComponents; // components filtered for this target
+  RteComponentIndex m_filteredComponentIndex; // index over m_filteredComponents
   RteComponentMap m_potentialComponents; // components filtered for this target regardless pack filter
   RteBundleMap m_filteredBundles; // collection of bundles with at least one filtered component
 
@@ -78,12 +78,15 @@ string RteCallback::ExpandString(const string& str) {
   if (!kernel) {
     return RteUtils::EMPTY_STRING;
   }
+  return ExpandString(str, kernel->GetActiveProject());
+}
+
+string RteCallback::ExpandString(const string& str, RteProject* activeProject) {
 
-  const auto activeProject = kernel->GetActiveProject();
   if (!activeProject) {
     return RteUtils::EMPTY_STRING;
   }
-  const auto activeTarget = kernel->GetActiveTarget();
+  const auto activeTarget = activeProject->GetActiveTarget();
   if (!activeTarget) {
     return RteUtils::EMPTY_STRING;
   }
@@ -77,7 +77,7 @@ bool RteComponent::Dominates(RteComponent *that) const {
 
   // both dominate: return true if this component version newer than that one
   if (thisDominating && thatDominating) {
-    return (VersionCmp::Compare(GetVersionString(), that->GetVersionString()) > 0);
+    return m_versionKey.Compare(that->GetVersionKey()) > 0;
   }
 
   return false;
@@ -181,6 +181,7 @@ const string& RteComponent::GetCbundleName() const
 
 string RteComponent::ConstructID()
 {
+  m_versionKey = VersionCmp::Key(GetVersionString());
   return GetComponentUniqueID();
 };
 
@@ -464,7 +465,7 @@ bool RteComponentAggregate::SetSelected(int nSel)
   return false;
 }
 
-bool RteComponentAggregate::MatchComponentAttributes(const map<string, string>& attributes, bool bRespectVersion) const
+bool RteComponentAggregate::MatchComponentAttributes(const XmlAttributes& attributes, bool bRespectVersion) const
 {
   if (!m_components.empty()) {
     for (auto [_, versionMap] : m_components) {
@@ -572,9 +573,7 @@ void RteComponentAggregate::AddComponent(RteComponent* c)
     if (insertedPack == devicePack)
       return; // component from device pack is already installed
     if (insertedPack && devicePack && pack && pack != devicePack) {
-      const string& packVersion = pack->GetVersionString();
-      const string& insertedPackVersion = insertedPack->GetVersionString();
-      if (VersionCmp::Compare(packVersion, insertedPackVersion) < 0)
+      if (pack->GetVersionKey().Compare(insertedPack->GetVersionKey()) < 0)
         return; // the inserted component comes from newer package
     }
   }
@@ -867,7 +866,7 @@ RteComponent* RteComponentAggregate::FindComponentMatch(const string& variant, c
   return nullptr;
 }
 
-RteComponent* RteComponentAggregate::FindComponent(const map<string, string>& attributes) const
+RteComponent* RteComponentAggregate::FindComponent(const XmlAttributes& attributes) const
 {
   {
     RteComponent* c = GetComponent();
@@ -1928,4 +1927,100 @@ RteComponentAggregate* RteComponentClassContainer::FindComponentAggregate(RteCom
   return nullptr;
 }
 
+namespace {
+const string COMPONENT_KEY_ATTRIBUTES[] = { "Cvendor", "Cclass", "Cgroup", "Csub", "Cvariant" };
+const vector<size_t> EMPTY_BUCKET;
+} // namespace
+
+void RteComponentIndex::Clear()
+{
+  m_components.clear();
+  m_keyBuckets.clear();
+  m_classBuckets.clear();
+  m_patterns.clear();
+}
+
+string RteComponentIndex::GetKey(const XmlAttributes& attributes)
+{
+  // a missing attribute matches only an empty value => treat it as empty
+  string key;
+  for (auto& a : COMPONENT_KEY_ATTRIBUTES) {
+    auto it = attributes.find(a);
+    if (it != attributes.end()) {
+      key += it->second;
+    }
+    key += '\n';
+  }
+  return key;
+}
+
+void RteComponentIndex::Build(const RteComponentMap& components)
+{
+  Clear();
+  m_components.reserve(components.size());
+  for (auto [_, c] : components) {
+    size_t pos = m_components.size();
+    m_components.push_back(c);
+    const XmlAttributes& attributes = c->GetAttributes();
+    bool bPattern = false;
+    for (auto& a : COMPONENT_KEY_ATTRIBUTES) {
+      auto it = attributes.find(a);
+      if (it != attributes.end() && WildCards::IsWildcardPattern(it->second)) {
+        bPattern = true;
+        break;
+      }
+    }
+    if (bPattern) {
+      m_patterns.push_back(pos);
+    } else {
+      m_keyBuckets[GetKey(attributes)].push_back(pos);
+      m_classBuckets[c->GetCclassName()].push_back(pos);
+    }
+  }
+}
+
+void RteComponentIndex::GetCandidates(const XmlAttributes& attributes, vector<RteComponent*>& candidates) const
+{
+  // an attribute narrows the search only if it is specified without wildcards
+  bool bFullKey = true;
+  bool bClass = false;
+  for (auto& a : COMPONENT_KEY_ATTRIBUTES) {
+    auto it = attributes.find(a);
+    bool bConstrained = it != attributes.end() && !WildCards::IsWildcardPattern(it->second);
+    if (!bConstrained) {
+      bFullKey = false;
+    } else if (a == "Cclass") {
+      bClass = true;
+    }
+  }
+  if (bFullKey) {
+    auto it = m_keyBuckets.find(GetKey(attributes));
+    Collect(it != m_keyBuckets.end() ? &it->second : &EMPTY_BUCKET, candidates);
+  } else if (bClass) {
+    auto it = m_classBuckets.find(attributes.find("Cclass")->second);
+    Collect(it != m_classBuckets.end() ? &it->second : &EMPTY_BUCKET, candidates);
+  } else {
+    Collect(nullptr, candidates);
+  }
+}
+
+void RteComponentIndex::Collect(const vector<size_t>* bucket, vector<RteComponent*>& candidates) const
+{
+  if (!bucket) {
+    candidates.insert(candidates.end(), m_components.begin(), m_components.end());
+    return;
+  }
+  // merge bucket with pattern components keeping original order
+  candidates.reserve(candidates.size() + bucket->size() + m_patterns.size());
+  auto itb = bucket->begin();
+  auto itp = m_patterns.begin();
+  while (itb != bucket->end() || itp != m_patterns.end()) {
+    if (itp == m_patterns.end() || (itb != bucket->end() && *itb < *itp)) {
+      candidates.push_back(m_components[*itb++]);
+    } else {
+      candidates.push_back(m_components[*itp++]);
+    }
+  }
+}
+
 // End of RteComponent.cpp
@@ -6,7 +6,7 @@
 */
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -96,6 +96,7 @@ string RteConditionExpression::ConstructID()
       m_domain = DEVICE_EXPRESSION;
     }
   }
+  CompilePredicates();
   if(IsDependencyExpression()) {
     return GetDependencyExpressionID();
   } else {
@@ -205,12 +206,10 @@ RteItem::ConditionResult RteConditionExpression::GetConditionResult(RteCondition
   return context->GetConditionResult(const_cast<RteConditionExpression*>(this));
 }
 
-RteItem::ConditionResult RteConditionExpression::EvaluateExpression(RteTarget* target)
+void RteConditionExpression::CompilePredicates()
 {
-  if(!target)
-    return FAILED;
-  const map<string, string>& attributes = target->GetAttributes();
-  for(auto [a, v] : m_attributes) {
+  m_predicates.clear();
+  for(const auto& [a, v] : m_attributes) {
     if(a.empty())
       continue;
     if(a.at(0) == 'C') {
@@ -219,24 +218,40 @@ RteItem::ConditionResult RteConditionExpression::EvaluateExpression(RteTarget* t
     if(a == "condition") {
       continue; // special handling for referred condition
     }
-    auto ita = attributes.find(a);
+    Predicate p = { a, v, Predicate::MATCH, 0 };
+    if(a == "Dvendor" || a == "Bvendor" || a == "vendor") {
+      p.m_kind = Predicate::VENDOR;
+    } else if(a == "Dcdecp") {
+      p.m_kind = Predicate::MASK;
+      p.m_mask = RteUtils::ToUL(v);
+    }
+    m_predicates.push_back(std::move(p));
+  }
+}
+
+RteItem::ConditionResult RteConditionExpression::EvaluateExpression(RteTarget* target)
+{
+  if(!target)
+    return FAILED;
+  const XmlAttributes& attributes = target->GetAttributes();
+  for(auto& p : m_predicates) {
+    auto ita = attributes.find(p.m_name);
     if(ita != attributes.end()) {
       const string& va = ita->second;
-      if(a == "Dvendor" || a == "Bvendor" || a == "vendor") {
-        if(!DeviceVendor::Match(va, v))
+      switch(p.m_kind) {
+      case Predicate::VENDOR:
+        if(!DeviceVendor::Match(va, p.m_value))
           return FAILED;
-        continue;
-      }
-      if(a == "Dcdecp") {
-        unsigned long uva = RteUtils::ToUL(va);
-        unsigned long uv = RteUtils::ToUL(v);
-        if((uva & uv) == 0) // alternatively we have considered if ((uva & uv) == uv)
+        break;
+      case Predicate::MASK:
+        if((RteUtils::ToUL(va) & p.m_mask) == 0) // alternatively we have considered if ((va & mask) == mask)
           return FAILED;
-        continue;
+        break;
+      default: // all other attributes
+        if(!WildCards::Match(va, p.m_value))
+          return FAILED;
+        break;
       }
-      // all other attributes
-      if(!WildCards::Match(va, v))
-        return FAILED;
     } else if(GetExpressionType() == DENY) {
       return FAILED; // for denied attributes, all must be given
     }
@@ -357,6 +372,24 @@ string RteCondition::GetDisplayName() const
   return s;
 }
 
+void RteCondition::Clear()
+{
+  m_expressions.clear();
+  RteItem::Clear();
+}
+
+void RteCondition::Construct()
+{
+  RteItem::Construct();
+  m_expressions.clear();
+  for(auto child : GetChildren()) {
+    RteConditionExpression* expr = dynamic_cast<RteConditionExpression*>(child);
+    if(expr) {
+      m_expressions.push_back(expr);
+    }
+  }
+}
+
 bool RteCondition::Validate()
 {
   m_bValid = RteItem::Validate();
@@ -400,30 +433,37 @@ bool RteCondition::ValidateRecursion()
 
 void RteCondition::CalcDeviceAndBoardDependentFlags()
 {
-  if(m_bDeviceDependent < 0 || m_bBoardDependent < 0) { // not yet calculated
-    m_bDeviceDependent = 0;
-    m_bBoardDependent = 0;
-    if(m_bInCheck) { // to prevent recursion
-      return;
+  // conditions of loaded packs are shared by targets that can be processed concurrently
+  static recursive_mutex calcMutex;
+  lock_guard<recursive_mutex> lock(calcMutex);
+  if(m_bDeviceDependent >= 0 && m_bBoardDependent >= 0) { // already calculated
+    return;
+  }
+  if(m_bInCheck) { // to prevent recursion
+    return;
+  }
+  m_bInCheck = true;
+  int bDeviceDependent = 0;
+  int bBoardDependent = 0;
+  for(auto child : GetChildren()) {
+    RteConditionExpression* expr = dynamic_cast<RteConditionExpression*>(child);
+    if(!expr) {
+      continue;
     }
-    m_bInCheck = true;
-    for(auto child : GetChildren()) {
-      RteConditionExpression* expr = dynamic_cast<RteConditionExpression*>(child);
-      if(!expr) {
-        continue;
-      }
-      if(expr->IsDeviceDependent()) {
-        m_bDeviceDependent = 1;
-      }
-      if(expr->IsBoardDependent()) {
-        m_bBoardDependent = 1;
-      }
-      if(m_bDeviceDependent > 0 && m_bBoardDependent > 0) {
-        break;
-      }
+    if(expr->IsDeviceDependent()) {
+      bDeviceDependent = 1;
+    }
+    if(expr->IsBoardDependent()) {
+      bBoardDependent = 1;
+    }
+    if(bDeviceDependent > 0 && bBoardDependent > 0) {
+      break;
     }
-    m_bInCheck = false;
   }
+  m_bInCheck = false;
+  // flags are published when complete
+  m_bDeviceDependent = bDeviceDependent;
+  m_bBoardDependent = bBoardDependent;
 }
 
 bool RteCondition::IsDeviceDependent() const
@@ -512,15 +552,13 @@ RteItem::ConditionResult RteCondition::Evaluate(RteConditionContext* context)
 
 bool RteCondition::IsEvaluating(RteConditionContext* context) const
 {
-  return m_evaluating.find(context) != m_evaluating.end();
+  return context && context->IsEvaluating(this);
 }
 
 void RteCondition::SetEvaluating(RteConditionContext* context, bool evaluating)
 {
-  if(evaluating) {
-    m_evaluating.insert(context);
-  } else {
-    m_evaluating.erase(context);
+  if(context) {
+    context->SetEvaluating(this, evaluating);
   }
 }
 
@@ -841,9 +879,56 @@ RteItem::ConditionResult RteDependencyResult::GetResult(const RteItem* item, con
 }
 
 
+RteItem::ConditionResult RteConditionResultCache::Results::Get(RteItem* item) const
+{
+  lock_guard<mutex> lock(m_mutex);
+  auto it = m_results.find(item);
+  return it != m_results.end() ? it->second : RteItem::UNDEFINED;
+}
+
+void RteConditionResultCache::Results::Set(RteItem* item, RteItem::ConditionResult res)
+{
+  lock_guard<mutex> lock(m_mutex);
+  m_results[item] = res;
+}
+
+void RteConditionResultCache::Results::Clear()
+{
+  lock_guard<mutex> lock(m_mutex);
+  m_results.clear();
+}
+
+RteConditionResultCache::Results* RteConditionResultCache::GetResults(const XmlAttributes& attributes)
+{
+  // expressions do not check C-attributes, all others can be referenced
+  string key;
+  for (auto [a, v] : attributes) {
+    if (!a.empty() && a.at(0) != 'C') {
+      key += a + '=' + v + '\n';
+    }
+  }
+  lock_guard<mutex> lock(m_mutex);
+  unique_ptr<Results>& results = m_results[key];
+  if (!results) {
+    results = make_unique<Results>();
+  }
+  return results.get();
+}
+
+void RteConditionResultCache::Clear()
+{
+  lock_guard<mutex> lock(m_mutex);
+  // targets keep pointers to the collections, only their content is cleared
+  for (auto& [_, results] : m_results) {
+    results->Clear();
+  }
+}
+
+
 RteConditionContext::RteConditionContext(RteTarget* target) :
   m_target(target),
   m_result(RteItem::UNDEFINED),
+  m_sharedResults(nullptr),
   m_verboseIndent(0)
 {
 }
@@ -857,8 +942,17 @@ void RteConditionContext::Clear()
 {
   m_result = RteItem::IGNORED;
   m_cachedResults.clear();
+  m_sharedResults = nullptr;
 }
 
+void RteConditionContext::SetEvaluating(const RteCondition* condition, bool evaluating)
+{
+  if(evaluating) {
+    m_evaluating.insert(condition);
+  } else {
+    m_evaluating.erase(condition);
+  }
+}
 
 bool RteConditionContext::IsVerbose() const
 {
@@ -891,7 +985,20 @@ RteItem::ConditionResult RteConditionContext::Evaluate(RteItem* item)
   VerboseIn(item);
   RteItem::ConditionResult res = GetConditionResult(item);
   if(res == RteItem::UNDEFINED) {
-    res = item->Evaluate(this);
+    // only items of model packs live as long as the shared results, generated and project items can be deleted any time
+    PackageState ps = m_sharedResults ? item->GetPackageState() : PackageState::PS_UNKNOWN;
+    RteConditionResultCache::Results* sharedResults =
+      (ps == PackageState::PS_UNKNOWN || ps == PackageState::PS_GENERATED) ? nullptr : m_sharedResults;
+    if(sharedResults) {
+      res = sharedResults->Get(item);
+    }
+    if(res == RteItem::UNDEFINED) {
+      res = item->Evaluate(this);
+      // recursion errors depend on evaluation order, do not share them
+      if(sharedResults && res != RteItem::R_ERROR) {
+        sharedResults->Set(item, res);
+      }
+    }
     m_cachedResults[item] = res;
   }
   VerboseOut(item, res);
@@ -913,10 +1020,7 @@ RteItem::ConditionResult RteConditionContext::EvaluateCondition(RteCondition* co
   RteItem::ConditionResult resultRequire = RteItem::IGNORED;
   RteItem::ConditionResult resultAccept = RteItem::UNDEFINED;
   // first check require and deny expressions
-  for(auto child : condition->GetChildren()) {
-    RteConditionExpression* expr = dynamic_cast<RteConditionExpression*>(child);
-    if(!expr)
-      continue;
+  for(auto expr : condition->GetExpressions()) {
     RteItem::ConditionResult res = Evaluate(expr);
     if(res == RteItem::R_ERROR)
       return res;
@@ -964,7 +1068,11 @@ RteItem::ConditionResult RteConditionContext::EvaluateExpression(RteConditionExp
 
 
 RteDependencySolver::RteDependencySolver(RteTarget* target) :
-  RteConditionContext(target)
+  RteConditionContext(target),
+  m_bEvaluating(false),
+  m_bIncremental(false),
+  m_revision(0),
+  m_fullRevision(0)
 {
 }
 
@@ -978,6 +1086,12 @@ void RteDependencySolver::Clear()
 {
   RteConditionContext::Clear();
   m_componentAggregates.clear();
+  m_dependencies.clear();
+  m_bIncremental = false;
+  m_aggregateStates.clear();
+  m_classStates.clear();
+  m_selectionState.clear();
+  m_structureState.clear();
 }
 
 bool RteDependencySolver::IsVerbose() const
@@ -986,6 +1100,43 @@ bool RteDependencySolver::IsVerbose() const
 }
 
 
+RteItem::ConditionResult RteDependencySolver::Evaluate(RteItem* item)
+{
+  Dependencies* parent = m_recording.empty() ? nullptr : m_recording.back();
+  Dependencies* dependencies = nullptr;
+  if(item && GetConditionResult(item) == RteItem::UNDEFINED) {
+    dependencies = &m_dependencies[item];
+    if(dependencies != parent) { // not a recursion
+      *dependencies = Dependencies();
+      dependencies->external = !m_bEvaluating;
+    }
+    m_recording.push_back(dependencies);
+  }
+  RteItem::ConditionResult res = RteConditionContext::Evaluate(item);
+  if(dependencies) {
+    m_recording.pop_back();
+    if(res == RteItem::R_ERROR) {
+      m_bIncremental = false; // recursion errors depend on evaluation order
+    }
+  }
+  if(item && parent) {
+    auto it = m_dependencies.find(item);
+    if(it != m_dependencies.end() && &it->second != parent) {
+      parent->Add(item, it->second);
+    }
+  }
+  return res;
+}
+
+void RteDependencySolver::Dependencies::Add(RteItem* item, const Dependencies& other)
+{
+  aggregates.insert(other.aggregates.begin(), other.aggregates.end());
+  classes.insert(other.classes.begin(), other.classes.end());
+  children.push_back(item);
+  selection |= other.selection;
+  external |= other.external;
+}
+
 RteItem::ConditionResult RteDependencySolver::EvaluateCondition(RteCondition* condition)
 {
   // new behavior - first check if filtering condition evaluates to FULFILLED or IGNORED
@@ -1028,7 +1179,11 @@ RteItem::ConditionResult RteDependencySolver::CalculateDependencies(RteCondition
 {
   set<RteComponentAggregate*> components;
   RteItem::ConditionResult result;
+  Dependencies* dependencies = m_recording.empty() ? nullptr : m_recording.back();
   if(expr->IsDenyExpression()) {
+    if(dependencies) {
+      dependencies->selection = true;
+    }
     result = RteItem::FULFILLED;
     const map<RteComponentAggregate*, int>& selectedComponents = m_target->GetSelectedComponentAggregates();
     for(auto [a, n] : selectedComponents) {
@@ -1042,6 +1197,10 @@ RteItem::ConditionResult RteDependencySolver::CalculateDependencies(RteCondition
     }
   } else {
     result = m_target->GetComponentAggregates(*expr, components);
+    if(dependencies) {
+      dependencies->aggregates.insert(components.begin(), components.end());
+      dependencies->classes.insert(expr->GetAttribute("Cclass"));
+    }
     if(components.size() > 1) {
       // leave only the component if it can be resolved automatically (current bundle, DFP)
       RteComponentAggregate* a = expr->GetSingleComponentAggregate(m_target, components);
@@ -1068,16 +1227,217 @@ const set<RteComponentAggregate*>& RteDependencySolver::GetComponentAggregates(R
 
 RteItem::ConditionResult RteDependencySolver::EvaluateDependencies()
 {
-  Clear();
+  const bool bIncremental = InvalidateChangedResults();
+  map<RteComponentAggregate*, AggregateState> previousSelection(m_selectionState.begin(), m_selectionState.end());
+  if(!bIncremental) {
+    Clear();
+  }
+  m_revision++;
   const map<RteComponentAggregate*, int>& selectedComponents = m_target->GetSelectedComponentAggregates();
+  if(bIncremental) {
+    // aggregates are changed if their selection or their result changes, results removed above are evaluated again
+    for(auto [a, n] : selectedComponents) {
+      auto it = previousSelection.find(a);
+      RteComponent* c = a->GetComponent();
+      RteCondition* condition = c ? c->GetCondition() : nullptr;
+      if(it == previousSelection.end() || it->second != GetAggregateState(a) ||
+        (condition && GetConditionResult(condition) == RteItem::UNDEFINED)) {
+        m_aggregateRevisions[a] = m_revision;
+      }
+      if(it != previousSelection.end()) {
+        previousSelection.erase(it);
+      }
+    }
+    for(auto& [a, _] : previousSelection) {
+      m_aggregateRevisions[a] = m_revision;
+    }
+  } else {
+    m_fullRevision = m_revision;
+    m_aggregateRevisions.clear();
+  }
+  m_result = RteItem::IGNORED;
+  m_bIncremental = true;
+  m_bEvaluating = true;
+  Dependencies roots;
+  m_recording.push_back(&roots);
   for(auto [a, n] : selectedComponents) {
     RteItem::ConditionResult res = a->Evaluate(this);
     if(res > RteItem::UNDEFINED && m_result > res)
       m_result = res;
   }
+  m_recording.pop_back();
+  m_bEvaluating = false;
+  UpdateIncrementalState(roots);
   return GetConditionResult();
 }
 
+bool RteDependencySolver::HasChanges(size_t revision) const
+{
+  return revision >= m_fullRevision && revision <= m_revision && m_fullRevision > 0;
+}
+
+set<RteComponentAggregate*> RteDependencySolver::GetChangedAggregates(size_t revision) const
+{
+  set<RteComponentAggregate*> aggregates;
+  for(auto& [a, r] : m_aggregateRevisions) {
+    if(r > revision) {
+      aggregates.insert(a);
+    }
+  }
+  return aggregates;
+}
+
+RteDependencySolver::AggregateState RteDependencySolver::GetAggregateState(const RteComponentAggregate* a)
+{
+  return { a->IsSelected(), a->GetComponent(), a->GetComponentInstance() };
+}
+
+string RteDependencySolver::GetClassState(const string& className) const
+{
+  // see RteComponentClassContainer::GetComponentAggregates()
+  RteComponentGroup* classGroup = m_target->GetClasses()->GetGroup(className);
+  return classGroup && classGroup->IsSelected() ? classGroup->GetSelectedBundleName() : RteUtils::EMPTY_STRING;
+}
+
+vector<pair<RteComponentAggregate*, RteDependencySolver::AggregateState> > RteDependencySolver::GetSelectionState() const
+{
+  vector<pair<RteComponentAggregate*, AggregateState> > state;
+  for(auto [a, n] : m_target->GetSelectedComponentAggregates()) {
+    state.push_back({ a, GetAggregateState(a) });
+  }
+  return state;
+}
+
+static void CollectAggregates(RteComponentGroup* group, vector<pair<RteComponentAggregate*, RteItem*> >& aggregates)
+{
+  for(auto child : group->GetChildren()) {
+    RteComponentAggregate* a = dynamic_cast<RteComponentAggregate*>(child);
+    if(a) {
+      // aggregates without components come and go with component instances
+      aggregates.push_back({ a, a->GetAllComponents().empty() ? a->GetComponentInstance() : nullptr });
+    }
+  }
+  for(auto [_, g] : group->GetGroups()) {
+    if(g) {
+      CollectAggregates(g, aggregates);
+    }
+  }
+}
+
+vector<pair<RteComponentAggregate*, RteItem*> > RteDependencySolver::GetStructureState() const
+{
+  vector<pair<RteComponentAggregate*, RteItem*> > state;
+  if(m_target->GetClasses()) {
+    CollectAggregates(m_target->GetClasses(), state);
+  }
+  return state;
+}
+
+bool RteDependencySolver::InvalidateChangedResults()
+{
+  if(!m_bIncremental || IsVerbose()) {
+    return false;
+  }
+  // added or removed aggregates can change the matches of any expression
+  if(GetStructureState() != m_structureState) {
+    return false;
+  }
+  set<RteComponentAggregate*> changedAggregates;
+  for(auto& [a, state] : m_aggregateStates) {
+    if(GetAggregateState(a) != state) {
+      changedAggregates.insert(a);
+    }
+  }
+  set<string> changedClasses;
+  for(auto& [className, state] : m_classStates) {
+    if(GetClassState(className) != state) {
+      changedClasses.insert(className);
+    }
+  }
+  const bool selectionChanged = GetSelectionState() != m_selectionState;
+  auto changed = [&](const Dependencies& dependencies) {
+    if(dependencies.external || (dependencies.selection && selectionChanged)) {
+      return true;
+    }
+    for(auto a : changedAggregates) {
+      if(dependencies.aggregates.find(a) != dependencies.aggregates.end()) {
+        return true;
+      }
+    }
+    for(auto& className : changedClasses) {
+      if(dependencies.classes.find(className) != dependencies.classes.end()) {
+        return true;
+      }
+    }
+    return false;
+  };
+  // dependencies include those of evaluated children: changed children invalidate their parents as well
+  vector<RteItem*> changedItems;
+  for(auto& [item, dependencies] : m_dependencies) {
+    if(changed(dependencies)) {
+      changedItems.push_back(item);
+    }
+  }
+  for(auto item : changedItems) {
+    EraseResult(item);
+  }
+  return true;
+}
+
+void RteDependencySolver::UpdateIncrementalState(const Dependencies& roots)
+{
+  // keep only results reachable from selected components, like a complete evaluation does
+  set<RteItem*> reachable;
+  vector<RteItem*> stack(roots.children.begin(), roots.children.end());
+  while(!stack.empty()) {
+    RteItem* item = stack.back();
+    stack.pop_back();
+    if(!reachable.insert(item).second) {
+      continue;
+    }
+    auto it = m_dependencies.find(item);
+    if(it != m_dependencies.end()) {
+      stack.insert(stack.end(), it->second.children.begin(), it->second.children.end());
+    }
+  }
+  vector<RteItem*> unreachable;
+  for(auto& [item, _] : m_dependencies) {
+    if(reachable.find(item) == reachable.end()) {
+      unreachable.push_back(item);
+    }
+  }
+  for(auto item : unreachable) {
+    EraseResult(item);
+  }
+
+  m_aggregateStates.clear();
+  m_classStates.clear();
+  if(!m_bIncremental || IsVerbose()) {
+    m_bIncremental = false;
+    m_selectionState.clear();
+    m_structureState.clear();
+    return;
+  }
+  for(auto a : roots.aggregates) {
+    m_aggregateStates[a] = GetAggregateState(a);
+  }
+  for(auto& className : roots.classes) {
+    m_classStates[className] = GetClassState(className);
+  }
+  m_selectionState = GetSelectionState();
+  m_structureState = GetStructureState();
+}
+
+void RteDependencySolver::EraseResult(RteItem* item)
+{
+  m_cachedResults.erase(item);
+  m_dependencies.erase(item);
+  RteConditionExpression* expr = dynamic_cast<RteConditionExpression*>(item);
+  if(expr) {
+    m_componentAggregates.erase(expr);
+  }
+}
+
 RteItem::ConditionResult RteDependencySolver::ResolveDependencies()
 {
   for(RteItem::ConditionResult res = GetConditionResult(); res < RteItem::FULFILLED; res = GetConditionResult()) {
@@ -20,6 +20,7 @@
 #include "XMLTree.h"
 
 #include <algorithm>
+#include <mutex>
 
 using namespace std;
 
@@ -27,7 +28,7 @@ static const list<RteDeviceProperty*> EMPTY_PROPERTY_LIST;
 
 const string& RteDeviceElement::GetEffectiveAttribute(const string& name) const
 {
-  map<string, string>::const_iterator it = m_attributes.find(name);
+  auto it = m_attributes.find(name);
   if (it != m_attributes.end())
     return it->second;
   // take from parent
@@ -40,7 +41,7 @@ const string& RteDeviceElement::GetEffectiveAttribute(const string& name) const
 
 bool RteDeviceElement::HasEffectiveAttribute(const string& name) const
 {
-  map<string, string>::const_iterator it = m_attributes.find(name);
+  auto it = m_attributes.find(name);
   if (it != m_attributes.end())
     return true;
   RteItem* parent = GetParent();
@@ -780,6 +781,9 @@ const list<RteDeviceProperty*>& RteEffectiveProperties::GetProperties(const stri
 const RteDevicePropertyMap& RteDeviceItem::GetEffectiveProperties(const string& pName)
 {
   if(pName.empty() || contains_key(m_processors, pName)) {
+    // properties are collected on demand, devices of loaded packs are shared by targets processed concurrently
+    static recursive_mutex collectMutex;
+    lock_guard<recursive_mutex> lock(collectMutex);
     auto itp = m_effectiveProperties.find(pName);
     if(itp != m_effectiveProperties.end()) {
       return itp->second.m_propertyMap;
@@ -70,7 +70,7 @@ RteItem::RteItem(const std::string& tag, RteItem* parent):
 {
 }
 
-RteItem::RteItem(const std::map<std::string, std::string>& attributes, RteItem* parent) :
+RteItem::RteItem(const XmlAttributes& attributes, RteItem* parent) :
   XmlTreeItem<RteItem>(parent, attributes),
   m_bValid(true)
 {
@@ -626,7 +626,7 @@ bool RteItem::MatchComponent(const RteItem& item) const
 }
 
 
-bool RteItem::MatchComponentAttributes(const map<string, string>& attributes, bool bRespectVersion) const
+bool RteItem::MatchComponentAttributes(const XmlAttributes& attributes, bool bRespectVersion) const
 {
   if (attributes.empty()) // no limiting attributes
     return true;
@@ -654,7 +654,7 @@ bool RteItem::MatchComponentAttributes(const map<string, string>& attributes, bo
 }
 
 
-bool RteItem::MatchApiAttributes(const map<string, string>& attributes, bool bRespectVersion) const
+bool RteItem::MatchApiAttributes(const XmlAttributes& attributes, bool bRespectVersion) const
 {
   if (attributes.empty())
     return false;
@@ -679,7 +679,7 @@ bool RteItem::MatchApiAttributes(const map<string, string>& attributes, bool bRe
 }
 
 
-bool RteItem::MatchDeviceAttributes(const map<string, string>& attributes) const
+bool RteItem::MatchDeviceAttributes(const XmlAttributes& attributes) const
 {
   if (attributes.empty())
     return false;
@@ -702,7 +702,7 @@ bool RteItem::MatchDeviceAttributes(const map<string, string>& attributes) const
   return true; // all attributes are found in supplied map
 }
 
-bool RteItem::MatchDevice(const map<string, string>& attributes) const
+bool RteItem::MatchDevice(const XmlAttributes& attributes) const
 {
   if (attributes.empty())
     return false;
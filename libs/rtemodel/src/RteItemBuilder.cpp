@@ -6,7 +6,7 @@
 */
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -34,6 +34,8 @@ RteItem* RteItemBuilder::CreateRootItem(const string& tag)
   RteItem* pRoot = nullptr;
   if (tag == "package" || tag == "generator-import") {
     RtePackage* pack = new RtePackage(m_rootParent, m_packState);
+    // items of a parsed pack live no longer than the pack, deleting it releases their memory at once
+    XmlItemArena::SetOwner(pack);
     m_packs.push_back(pack);
     pRoot = pack;
   } else if (tag == "cprj") {
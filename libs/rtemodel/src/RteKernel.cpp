@@ -6,7 +6,7 @@
 */
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -17,6 +17,7 @@
 #include "RteCprjProject.h"
 #include "CprjFile.h"
 #include "RteItemBuilder.h"
+#include "RtePackCache.h"
 
 #include "RteUtils.h"
 #include "RteFsUtils.h"
@@ -27,6 +28,9 @@
 
 #include "CollectionUtils.h"
 
+#include <atomic>
+#include <thread>
+
 using namespace std;
 
 static string schemaFile = "CPRJ.xsd";
@@ -42,10 +46,16 @@ static constexpr const char* R822 = "Pack 'path' was not found";
 static constexpr const char* R823 = "No PDSC file was found";
 static constexpr const char* R824 = "Multiple PDSC files were found";
 
+const set<string> RteKernel::PACK_HEADER_TAGS = { "vendor", "name", "description", "url", "releases" };
+
 RteKernel::RteKernel(RteCallback* rteCallback, RteGlobalModel* globalModel) :
 m_globalModel(globalModel),
 m_bOwnModel(false),
-m_rteCallback(rteCallback)
+m_rteCallback(rteCallback),
+m_packLoadThreads(1),
+m_bPackCache(false),
+m_bPackCacheWritten(false),
+m_bPackCacheReadOnly(false)
 {
   if (!m_globalModel) {
     m_globalModel = new RteGlobalModel();
@@ -290,7 +300,89 @@ void RteKernel::ClearExternalGenerators()
   m_externalGeneratorFiles.clear();
 }
 
+string RteKernel::GetPackCacheDir() const
+{
+  if(!m_bPackCache || GetCmsisPackRoot().empty()) {
+    return RteUtils::EMPTY_STRING;
+  }
+  return GetCmsisPackRoot() + "/.Local/.cache";
+}
+
+string RteKernel::GetPackCacheParserInfo() const
+{
+  lock_guard<mutex> lock(m_xmlTreeMutex);
+  if(m_packCacheParserInfo.empty()) {
+    unique_ptr<XMLTree> xmlTree = CreateUniqueXmlTree(nullptr, ".pdsc");
+    m_packCacheParserInfo = GetToolInfo().GetAttribute("name") + "@" + GetToolInfo().GetAttribute("version") + ";" +
+      (xmlTree ? xmlTree->GetParseOptions() : RteUtils::EMPTY_STRING);
+  }
+  return m_packCacheParserInfo;
+}
+
+void RteKernel::PrunePackCache() const
+{
+  // the cache only grows when files are written
+  if(m_bPackCacheWritten.exchange(false)) {
+    RtePackCache(GetPackCacheDir()).Prune();
+  }
+}
+
+string RteKernel::GetPackIndexFile() const
+{
+  if(!m_bPackCache || GetCmsisPackRoot().empty()) {
+    return RteUtils::EMPTY_STRING;
+  }
+  return GetCmsisPackRoot() + "/.Local/installed_packs.idx";
+}
+
+RtePackIndex* RteKernel::GetPackIndex() const
+{
+  const string indexFile = GetPackIndexFile();
+  if(indexFile.empty()) {
+    return nullptr;
+  }
+  if(m_packIndex && m_packIndex->GetPackRoot() == GetCmsisPackRoot()) {
+    return m_packIndex.get();
+  }
+  m_packIndex = make_unique<RtePackIndex>(GetCmsisPackRoot());
+  if(!m_packIndex->Load(indexFile) || !m_packIndex->IsValid()) {
+    m_packIndex->Scan();
+    m_packIndex->Save(indexFile);
+  }
+  return m_packIndex.get();
+}
+
+void RteKernel::UpdatePackIndex(const list<RtePackage*>& packs) const
+{
+  lock_guard<mutex> lock(m_packIndexMutex);
+  RtePackIndex* packIndex = GetPackIndex();
+  if(!packIndex) {
+    return;
+  }
+  for(auto pack : packs) {
+    packIndex->UpdateEntry(pack);
+  }
+  if(packIndex->IsModified()) {
+    packIndex->Save(GetPackIndexFile());
+  }
+}
+
+unsigned RteKernel::GetPackLoadThreads() const
+{
+  unsigned nThreads = m_packLoadThreads;
+  if(nThreads == 0) {
+    nThreads = thread::hardware_concurrency();
+  }
+  return nThreads > 0 ? nThreads : 1;
+}
+
 RtePackage* RteKernel::LoadPack(const string& pdscFile, PackageState packState) const
+{
+  map<string, PackParseResult> parsedPacks;
+  return LoadPack(pdscFile, packState, parsedPacks);
+}
+
+RtePackage* RteKernel::LoadPack(const string& pdscFile, PackageState packState, map<string, PackParseResult>& parsedPacks) const
 {
   if(pdscFile.empty()) {
     return nullptr;
@@ -300,14 +392,18 @@ RtePackage* RteKernel::LoadPack(const string& pdscFile, PackageState packState)
   if(pack && !pack->IsFileTimeModified()) {
     return pack;
   }
-  const string ext = RteUtils::ExtractFileExtension(pdscFile, true);
-  auto rteItemBuilder= CreateUniqueRteItemBuilder(GetGlobalModel(), packState);
-  unique_ptr<XMLTree> xmlTree = CreateUniqueXmlTree(rteItemBuilder.get(), ext);
-  bool success = xmlTree->AddFileName(pdscFile, true);
-  pack = rteItemBuilder->GetPack();
-  if (!success || !pack) {
+  PackParseResult result;
+  auto it = parsedPacks.find(pdscFile);
+  if(it != parsedPacks.end()) {
+    result = std::move(it->second);
+    parsedPacks.erase(it);
+  } else {
+    ParsePack(pdscFile, GetGlobalModel(), packState, result);
+  }
+  pack = result.pack;
+  if (!result.success || !pack) {
     GetRteCallback()->Err("R802", R802, pdscFile);
-    GetRteCallback()->OutputMessages(xmlTree->GetErrorStrings());
+    GetRteCallback()->OutputMessages(result.errors);
     return nullptr;
   }
   if(packState != PackageState::PS_GENERATED) {
@@ -319,6 +415,90 @@ RtePackage* RteKernel::LoadPack(const string& pdscFile, PackageState packState)
   return pack;
 }
 
+void RteKernel::ParsePack(const string& pdscFile, RteItem* rootParent, PackageState packState, PackParseResult& result) const
+{
+  const string ext = RteUtils::ExtractFileExtension(pdscFile, true);
+  auto rteItemBuilder = CreateUniqueRteItemBuilder(rootParent, packState);
+  // only pdsc files are cached, gpdsc files are frequently regenerated
+  const string cacheDir = ext == ".pdsc" ? GetPackCacheDir() : RteUtils::EMPTY_STRING;
+  RtePackCache packCache(cacheDir, cacheDir.empty() ? RteUtils::EMPTY_STRING : GetPackCacheParserInfo());
+  if(packCache.Load(pdscFile, rteItemBuilder.get())) {
+    result.pack = rteItemBuilder->GetPack();
+    result.success = result.pack != nullptr;
+    if(result.success) {
+      return;
+    }
+    rteItemBuilder->Clear(true);
+    rteItemBuilder = CreateUniqueRteItemBuilder(rootParent, packState);
+  }
+  const bool bRecord = !cacheDir.empty() && !m_bPackCacheReadOnly;
+  RtePackCacheRecorder recorder(rteItemBuilder.get());
+  IXmlItemBuilder* itemBuilder = bRecord ? static_cast<IXmlItemBuilder*>(&recorder) : rteItemBuilder.get();
+  unique_ptr<XMLTree> xmlTree;
+  {
+    lock_guard<mutex> lock(m_xmlTreeMutex);
+    xmlTree = CreateUniqueXmlTree(itemBuilder, ext);
+  }
+  // the file time is taken before parsing, Save() rejects a file modified meanwhile
+  const fs::file_time_type fileTime = bRecord ? RteFsUtils::GetModificationTime(pdscFile) : fs::file_time_type();
+  result.success = xmlTree->AddFileName(pdscFile, true);
+  result.pack = rteItemBuilder->GetPack();
+  result.errors = xmlTree->GetErrorStrings();
+  // cache only files parsed without any message to reproduce the same output
+  if(bRecord && result.success && result.pack && !xmlTree->HasErrors() && !xmlTree->HasWarnings()) {
+    if(packCache.Save(pdscFile, fileTime, recorder)) {
+      m_bPackCacheWritten = true;
+    } else {
+      m_bPackCacheReadOnly = true; // do not retry writing for every pack
+    }
+  }
+}
+
+unique_ptr<RtePackage> RteKernel::ScanPack(const string& pdscFile, const set<string>& scanTags) const
+{
+  auto rteItemBuilder = CreateUniqueRteItemBuilder();
+  unique_ptr<XMLTree> xmlTree;
+  {
+    lock_guard<mutex> lock(m_xmlTreeMutex);
+    xmlTree = CreateUniqueXmlTree(rteItemBuilder.get(), RteUtils::ExtractFileExtension(pdscFile, true));
+  }
+  if(!xmlTree) {
+    return nullptr;
+  }
+  xmlTree->SetScanTags(scanTags);
+  const bool success = xmlTree->AddFileName(pdscFile, true);
+  unique_ptr<RtePackage> pack(rteItemBuilder->GetPack());
+  if(!success) {
+    return nullptr;
+  }
+  return pack;
+}
+
+void RteKernel::ParsePacks(const vector<pair<string, PackageState> >& pdscFiles, RteItem* rootParent,
+                           map<string, PackParseResult>& parsedPacks) const
+{
+  // workers fetch the next file index, results are stored by index to keep the input order
+  vector<PackParseResult> results(pdscFiles.size());
+  atomic<size_t> next(0);
+  auto worker = [&]() {
+    for(size_t i = next++; i < pdscFiles.size(); i = next++) {
+      ParsePack(pdscFiles[i].first, rootParent, pdscFiles[i].second, results[i]);
+    }
+  };
+  size_t nThreads = std::min<size_t>(GetPackLoadThreads(), pdscFiles.size());
+  vector<thread> threads;
+  for(size_t i = 1; i < nThreads; i++) {
+    threads.emplace_back(worker);
+  }
+  worker(); // calling thread is a worker as well
+  for(auto& t : threads) {
+    t.join();
+  }
+  for(size_t i = 0; i < pdscFiles.size(); i++) {
+    parsedPacks[pdscFiles[i].first] = std::move(results[i]);
+  }
+}
+
 bool RteKernel::LoadPacks(const std::list<std::string>& pdscFiles, std::list<RtePackage*>& packs, RteModel* model, bool bReplace) const
 {
   bool success = true;
@@ -329,10 +509,21 @@ bool RteKernel::LoadPacks(const std::list<std::string>& pdscFiles, std::list<Rte
     model = GetGlobalModel();
   }
   RtePackRegistry* packRegistry = GetPackRegistry();
-  unique_ptr<XMLTree> xmlTree = CreateUniqueXmlTree();
+  map<string, PackParseResult> parsedPacks;
+  if(GetPackLoadThreads() > 1) {
+    // parse files that cannot be taken from the registry upfront, insert them in the original order below
+    vector<pair<string, PackageState> > toParse;
+    set<string> collected;
+    for(auto& pdscFile : pdscFiles) {
+      RtePackage* pack = packRegistry->GetPack(pdscFile);
+      if((bReplace || !pack || pack->IsFileTimeModified()) && collected.insert(pdscFile).second) {
+        toParse.push_back(make_pair(pdscFile, model->GetPackageState()));
+      }
+    }
+    ParsePacks(toParse, model, parsedPacks);
+  }
+  list<string> parsedErrors; // collected in the same way as a shared XMLTree does
   for(auto& pdscFile : pdscFiles) {
-    auto rteItemBuilder = CreateUniqueRteItemBuilder(model, model->GetPackageState());
-    xmlTree->SetXmlItemBuilder(rteItemBuilder.get());
     RtePackage* pack = packRegistry->GetPack(pdscFile);
     if(bReplace || !pack || pack->IsFileTimeModified()) {
       packRegistry->ErasePack(pdscFile);
@@ -341,11 +532,20 @@ bool RteKernel::LoadPacks(const std::list<std::string>& pdscFiles, std::list<Rte
       pack->Reparent(model, false);
       continue;
     }
-    bool result = xmlTree->AddFileName(pdscFile, true);
-    pack = rteItemBuilder->GetPack();
+    PackParseResult parseResult;
+    auto it = parsedPacks.find(pdscFile);
+    if(it != parsedPacks.end()) {
+      parseResult = std::move(it->second);
+      parsedPacks.erase(it);
+    } else {
+      ParsePack(pdscFile, model, model->GetPackageState(), parseResult);
+    }
+    parsedErrors.insert(parsedErrors.end(), parseResult.errors.begin(), parseResult.errors.end());
+    bool result = parseResult.success;
+    pack = parseResult.pack;
     if(!result || !pack) {
       GetRteCallback()->Err("R802", R802, pdscFile);
-      GetRteCallback()->OutputMessages(xmlTree->GetErrorStrings());
+      GetRteCallback()->OutputMessages(parsedErrors);
       success = false;
     } else {
       if(packRegistry->AddPack(pack, bReplace)) {
@@ -354,8 +554,16 @@ bool RteKernel::LoadPacks(const std::list<std::string>& pdscFiles, std::list<Rte
         delete pack;
       }
     }
-    GetRteCallback()->PackProcessed(pdscFile, result);
+    if(!GetRteCallback()->PackProcessed(pdscFile, result)) {
+      // processing stopped by the callback
+      success = false;
+      break;
+    }
+  }
+  for(auto& [_, result] : parsedPacks) {
+    delete result.pack;
   }
+  PrunePackCache();
   return success;
 }
 
@@ -467,17 +675,64 @@ bool RteKernel::LoadAndInsertPacks(std::list<RtePackage*>& packs, std::list<std:
   if(!globalModel) {
     return false;
   }
+  auto pdscFileState = [this](const string& pdscFile) {
+    return pdscFile.find(GetCmsisPackRoot()) == 0 ? PS_INSTALLED : PS_EXPLICIT_PATH;
+  };
   std::list<RtePackage*> newPacks;
   pdscFiles.unique();
+  RtePackRegistry* packRegistry = GetPackRegistry();
+  // a modified pack replaces the registry one, which must not stay in the model
+  bool bReplaced = false;
   for(const auto& pdscFile : pdscFiles) {
-    PackageState state = pdscFile.find(GetCmsisPackRoot()) == 0 ? PS_INSTALLED : PS_EXPLICIT_PATH;
-    RtePackage* pack = LoadPack(pdscFile, state);
-    if(!pack) {
-      return false;
+    RtePackage* pack = packRegistry->GetPack(pdscFile);
+    if(pack && globalModel->GetPackage(pack->GetID()) == pack && pack->IsFileTimeModified()) {
+      bReplaced = true;
+      break;
+    }
+  }
+  if(bReplaced) {
+    // refill the model with the other inserted packs
+    const set<string> files(pdscFiles.begin(), pdscFiles.end());
+    for(const auto& [_, pack] : globalModel->GetPackages()) {
+      if(files.find(pack->GetPackageFileName()) == files.end()) {
+        newPacks.push_back(pack);
+      }
+    }
+    globalModel->ClearModel();
+  }
+  map<string, PackParseResult> parsedPacks;
+  if(GetPackLoadThreads() > 1) {
+    // parse files not yet in the registry upfront, insert them in the original order below
+    vector<pair<string, PackageState> > toParse;
+    set<string> collected;
+    for(const auto& pdscFile : pdscFiles) {
+      RtePackage* pack = packRegistry->GetPack(pdscFile);
+      if((!pack || pack->IsFileTimeModified()) && collected.insert(pdscFile).second) {
+        toParse.push_back(make_pair(pdscFile, pdscFileState(pdscFile)));
+      }
+    }
+    ParsePacks(toParse, globalModel, parsedPacks);
+  }
+  bool success = true;
+  for(const auto& pdscFile : pdscFiles) {
+    RtePackage* pack = LoadPack(pdscFile, pdscFileState(pdscFile), parsedPacks);
+    if(!GetRteCallback()->PackProcessed(pdscFile, pack != nullptr) || !pack) {
+      // error or processing stopped by the callback
+      success = false;
+      break;
     }
     newPacks.push_back(pack);
   }
+  // delete packs parsed in advance, but not inserted because of an error
+  for(auto& [_, result] : parsedPacks) {
+    delete result.pack;
+  }
+  PrunePackCache();
+  if(!success) {
+    return false;
+  }
   globalModel->InsertPacks(newPacks);
+  UpdatePackIndex(newPacks);
 
   // Track only packs that were actually inserted into the model
   packs.clear();
@@ -491,7 +746,17 @@ bool RteKernel::LoadAndInsertPacks(std::list<RtePackage*>& packs, std::list<std:
 void RteKernel::GetInstalledPdscFiles(std::map<std::string, std::string, RtePackageComparator>& pdscMap) const
 {
   list<string> allFiles;
-  RteFsUtils::GetPackageDescriptionFiles(allFiles, GetCmsisPackRoot(), 3);
+  {
+    lock_guard<mutex> lock(m_packIndexMutex);
+    RtePackIndex* packIndex = GetPackIndex();
+    if(packIndex) {
+      for(auto& e : packIndex->GetEntries()) {
+        allFiles.push_back(e.pdscFile);
+      }
+    } else {
+      RteFsUtils::GetPackageDescriptionFiles(allFiles, GetCmsisPackRoot(), 3);
+    }
+  }
   for (auto& f : allFiles) {
     string id = RteUtils::ToLower(RtePackage::PackIdFromPath(f));
     pdscMap[id] = f;
@@ -582,13 +847,18 @@ bool RteKernel::GetLocalPdscFiles(const XmlItem& attr, std::map<std::string, std
     if ((name.empty() || name == item->GetAttribute("name"))
         && (vendor.empty() || vendor == item->GetAttribute("vendor")))
     {
-      // Load the local pack to get its version. The 'version' attribute in the local repository index is ignored.
+      // Scan the local pack to get its version. The 'version' attribute in the local repository index is ignored.
       string url = RteFsUtils::GetAbsPathFromLocalUrl(item->GetAttribute("url"));
       if(RteFsUtils::IsRelative(url)) {
         url = RteFsUtils::MakePathCanonical(item->GetRootFilePath() + url) + '/';
       }
       const string localPdscFile = url + item->GetAttribute("vendor") + '.' + item->GetAttribute("name") + ".pdsc";
-      RtePackage* pack = LoadPack(localPdscFile);
+      RtePackage* pack = GetPackRegistry()->GetPack(localPdscFile);
+      unique_ptr<RtePackage> scannedPack;
+      if(!pack || pack->IsFileTimeModified()) {
+        scannedPack = ScanPack(localPdscFile);
+        pack = scannedPack ? scannedPack.get() : LoadPack(localPdscFile); // LoadPack() reports errors
+      }
       if(pack) {
         const string& version = pack->GetVersionString();
         if(versionRange.empty() || VersionCmp::RangeCompare(version, versionRange) == 0) {
@@ -658,13 +928,35 @@ bool RteKernel::ReadPackLatestVerAndPath(map<string, pair<string, string>>& late
   map<string, string, RtePackageComparator> effectivePdscMap;
   if (GetEffectivePdscFilesAsMap(effectivePdscMap, true)) {
     for (const auto& [_, localPdscFile] : effectivePdscMap) {
-      RtePackage* pack = LoadPack(localPdscFile);
-      if (!pack) {
-        continue;
+      // take pack identity from the installed pack index if the pack has been loaded before
+      string vendor, name, version;
+      bool bIndexed = false;
+      {
+        lock_guard<mutex> lock(m_packIndexMutex);
+        RtePackIndex* packIndex = GetPackIndex();
+        const RtePackIndex::Entry* entry = packIndex ? packIndex->GetEntry(localPdscFile) : nullptr;
+        if (entry && RtePackIndex::IsCurrent(*entry)) {
+          vendor = RtePackage::VendorFromId(entry->id);
+          name = RtePackage::NameFromId(entry->id);
+          version = RteUtils::GetSuffix(entry->id, RteConstants::PREFIX_PACK_VERSION_CHAR);
+          bIndexed = true;
+        }
+      }
+      if (!bIndexed) {
+        // only pack identity is needed: use loaded pack or scan pdsc header
+        RtePackage* pack = GetPackRegistry()->GetPack(localPdscFile);
+        unique_ptr<RtePackage> scannedPack;
+        if (!pack || pack->IsFileTimeModified()) {
+          scannedPack = ScanPack(localPdscFile);
+          pack = scannedPack ? scannedPack.get() : LoadPack(localPdscFile); // LoadPack() reports errors
+        }
+        if (!pack) {
+          continue;
+        }
+        vendor = pack->GetVendorString();
+        name = pack->GetName();
+        version = pack->GetVersionString();
       }
-      const string& vendor = pack->GetVendorString();
-      const string& name = pack->GetName();
-      const string& version = pack->GetVersionString();
       if (vendor.empty() || name.empty() || version.empty()) {
         continue;
       }
@@ -22,6 +22,9 @@
 #include "RteConstants.h"
 
 #include "XMLTree.h"
+#include "WildCards.h"
+
+#include <algorithm>
 
 using namespace std;
 
@@ -77,6 +80,7 @@ void RteModel::ClearModel()
   m_packageDuplicates.clear();
   m_packages.clear();
   m_latestPackages.clear();
+  m_conditionResultCache.Clear();
 
   m_children.clear(); // clear children here, the packs are deleted by RtePackRegistry
   RteItem::Clear();
@@ -90,6 +94,13 @@ void RteModel::ClearDevices()
   m_deviceVendors.clear();
   m_deviceTree->Clear();
   m_boards.clear();
+
+  m_deviceIndex.clear();
+  m_deviceAggregateIndex.clear();
+  m_vendorDeviceAggregateIndex.clear();
+  m_deviceNames.Clear();
+  m_boardIndex.clear();
+  m_boardNames.Clear();
 }
 
 
@@ -161,14 +172,24 @@ RtePackage* RteModel::GetPackage(const XmlItem& attr) const
 
 RteBoard* RteModel::FindBoard(const string& displayName) const
 {
-  for(auto [_, b] : GetBoards()) {
-    if(b->GetDisplayName() == displayName) {
-      return b;
-    }
+  auto it = m_boardIndex.find(displayName);
+  if(it != m_boardIndex.end()) {
+    return it->second;
   }
   return nullptr;
 }
 
+void RteModel::GetBoards(list<RteBoard*>& boards, const string& namePattern, const string& vendor) const
+{
+  vector<const NameIndex::Entry*> found;
+  m_boardNames.Find(namePattern, false, found);
+  for(auto entry : found) {
+    if(vendor.empty() || entry->vendor == vendor) {
+      boards.push_back(static_cast<RteBoard*>(entry->item));
+    }
+  }
+}
+
 void RteModel::GetCompatibleBoards(vector<RteBoard*>& boards, RteDeviceItem* device, bool bOnlyMounted) const
 {
   if(!device) {
@@ -250,7 +271,7 @@ RteComponent* RteModel::GetComponent(RteComponentInstance* ci, bool matchVersion
 }
 
 
-RteApi* RteModel::GetApi(const map<string, string>& componentAttributes) const
+RteApi* RteModel::GetApi(const XmlAttributes& componentAttributes) const
 {
   RteApi* api = nullptr;
   for(auto [_, a] : m_apiList) {
@@ -368,6 +389,8 @@ void RteModel::Construct()
 
 void RteModel::InsertPacks(const list<RtePackage*>& packs)
 {
+  // inserted packs can replace conditions referenced by cached results
+  m_conditionResultCache.Clear();
   for(auto pack : packs) {
     InsertPack(dynamic_cast<RtePackage*>(pack));
   }
@@ -407,7 +430,7 @@ void RteModel::InsertPack(RtePackage* package)
   // add to latest package map
   const string& commonId = package->GetCommonID();
   RtePackage* p = GetLatestPackage(commonId);
-  if(!p || p == insertedPack || VersionCmp::Compare(package->GetVersionString(), p->GetVersionString()) > 0) {
+  if(!p || p == insertedPack || package->GetVersionKey().Compare(p->GetVersionKey()) > 0) {
     m_latestPackages[commonId] = package;
   }
   if(insertedPack) {
@@ -465,7 +488,7 @@ RtePackage* RteModel::FilterModel(RteModel* globalModel, RtePackage* devicePacka
     }
     const string& commonId = pack->GetCommonID();
     RtePackage* p = GetLatestPackage(commonId);
-    if(!p || VersionCmp::Compare(pack->GetVersionString(), p->GetVersionString()) > 0) {
+    if(!p || pack->GetVersionKey().Compare(p->GetVersionKey()) > 0) {
       m_latestPackages[commonId] = pack;
     }
   }
@@ -666,7 +689,22 @@ void RteModel::GetDevices(list<RteDevice*>& devices, const string& namePattern,
 {
   if(namePattern.empty() || namePattern.find_first_of("*?[") != string::npos) {
     if(IsUseDeviceTree()) {
-      m_deviceTree->GetDevices(devices, namePattern, vendor, depth); // pattern match
+      // pattern match, the same result as m_deviceTree->GetDevices(devices, namePattern, vendor, depth)
+      string vendorName;
+      if(!vendor.empty()) {
+        RteDeviceItemAggregate* da = m_deviceTree->GetDeviceAggregate(DeviceVendor::GetCanonicalVendorName(vendor));
+        if(!da) {
+          return;
+        }
+        vendorName = da->GetName();
+      }
+      vector<const NameIndex::Entry*> found;
+      m_deviceNames.Find(namePattern, true, found);
+      for(auto entry : found) {
+        if(entry->type <= depth && (vendorName.empty() || entry->vendor == vendorName)) {
+          devices.push_back(static_cast<RteDevice*>(entry->item));
+        }
+      }
       return;
     }
     for(auto [_, dv] : m_deviceVendors) {
@@ -691,14 +729,18 @@ RteDevice* RteModel::GetDevice(const string& deviceName, const string& vendor) c
 
     }
   } else {
-    for(auto [_, dv] : m_deviceVendors) {
-      RteDevice* d = dv->GetDevice(deviceName);
-      if(d)
-        return d;
-    }
+    // the same result as iterating vendors in order and trying the name without processor suffix after the full name
+    auto it = m_deviceIndex.find(deviceName);
+    auto itPrefix = m_deviceIndex.find(RteUtils::GetPrefix(deviceName));
+    if(it != m_deviceIndex.end() && (itPrefix == m_deviceIndex.end() || it->second.first <= itPrefix->second.first))
+      return it->second.second;
+    if(itPrefix != m_deviceIndex.end())
+      return itPrefix->second.second;
+  }
+  if(IsUseDeviceTree()) {
+    RteDeviceItemAggregate* da = GetDeviceAggregate(deviceName, vendor);
+    return da ? dynamic_cast<RteDevice*>(da->GetDeviceItem()) : NULL;
   }
-  if(IsUseDeviceTree())
-    return dynamic_cast<RteDevice*>(m_deviceTree->GetDeviceItem(deviceName, vendor));
   return NULL;
 }
 
@@ -721,7 +763,16 @@ int RteModel::GetDeviceCount(const string& vendor) const
 
 
 RteDeviceItemAggregate* RteModel::GetDeviceAggregate(const string& deviceName, const string& vendor) const {
-  return (m_deviceTree->GetDeviceAggregate(deviceName, vendor));
+  const RteDeviceItemAggregateMap* index = &m_deviceAggregateIndex;
+  if(!vendor.empty()) {
+    auto itv = m_vendorDeviceAggregateIndex.find(DeviceVendor::GetCanonicalVendorName(vendor));
+    if(itv == m_vendorDeviceAggregateIndex.end()) {
+      return nullptr;
+    }
+    index = &itv->second;
+  }
+  auto it = index->find(deviceName);
+  return it != index->end() ? it->second : nullptr;
 }
 
 RteDeviceItemAggregate* RteModel::GetDeviceItemAggregate(const string& name, const string& vendor) const {
@@ -745,16 +796,17 @@ void RteModel::FillDeviceTree()
     FillDeviceTree(package);
   }
 
-  if(!bHasDeprecated)
-    return;
-  for(auto [id, package] : m_latestPackages) {
-    if(!package)
-      continue;
-    if(!package->IsDeprecated()) {
-      continue;
+  if(bHasDeprecated) {
+    for(auto [id, package] : m_latestPackages) {
+      if(!package)
+        continue;
+      if(!package->IsDeprecated()) {
+        continue;
+      }
+      FillDeviceTree(package);
     }
-    FillDeviceTree(package);
   }
+  UpdateDeviceIndex();
 }
 
 void RteModel::FillDeviceTree(RtePackage* package)
@@ -788,6 +840,112 @@ void RteModel::FillDeviceTree(RtePackage* package)
 }
 
 
+namespace {
+
+// insert aggregates in the order RteDeviceItemAggregate::GetDeviceAggregate() checks them: children first, then their sub-trees
+void IndexDeviceAggregates(RteDeviceItemAggregate* da, RteDeviceItemAggregateMap& index)
+{
+  for(auto [name, child] : da->GetChildren()) {
+    if(child->GetType() > RteDeviceItem::SUBFAMILY) {
+      index.emplace(name, child);
+    }
+  }
+  for(auto [_, child] : da->GetChildren()) {
+    IndexDeviceAggregates(child, index);
+  }
+}
+
+} // namespace
+
+void RteModel::UpdateDeviceIndex()
+{
+  m_deviceIndex.clear();
+  m_deviceAggregateIndex.clear();
+  m_vendorDeviceAggregateIndex.clear();
+  m_deviceNames.Clear();
+  m_boardIndex.clear();
+  m_boardNames.Clear();
+
+  size_t rank = 0;
+  for(auto [_, dv] : m_deviceVendors) {
+    for(auto [name, d] : dv->GetDevices()) {
+      m_deviceIndex.emplace(name, make_pair(rank, d));
+    }
+    rank++;
+  }
+
+  IndexDeviceAggregates(m_deviceTree, m_deviceAggregateIndex);
+  for(auto [vendorName, da] : m_deviceTree->GetChildren()) {
+    IndexDeviceAggregates(da, m_vendorDeviceAggregateIndex[vendorName]);
+  }
+  // device tree leaves in the traversal order of RteDeviceItemAggregate::GetDevices()
+  list<pair<RteDeviceItemAggregate*, string> > stack;
+  for(auto it = m_deviceTree->GetChildren().rbegin(); it != m_deviceTree->GetChildren().rend(); ++it) {
+    stack.push_front(make_pair(it->second, it->first));
+  }
+  while(!stack.empty()) {
+    auto [da, vendorName] = stack.front();
+    stack.pop_front();
+    if(da->GetType() > RteDeviceItem::SUBFAMILY) {
+      RteDevice* d = dynamic_cast<RteDevice*>(da->GetDeviceItem());
+      if(d) {
+        m_deviceNames.Add(d->GetName(), vendorName, da->GetType(), d);
+      }
+    }
+    for(auto it = da->GetChildren().rbegin(); it != da->GetChildren().rend(); ++it) {
+      stack.push_front(make_pair(it->second, vendorName));
+    }
+  }
+  m_deviceNames.Sort();
+
+  for(auto [id, b] : m_boards) {
+    m_boardIndex.emplace(b->GetDisplayName(), b);
+    m_boardNames.Add(id, b->GetVendorString(), RteDeviceItem::VENDOR_LIST, b);
+  }
+  m_boardNames.Sort();
+}
+
+void RteModel::NameIndex::Clear()
+{
+  entries.clear();
+  bNamePatterns = false;
+}
+
+void RteModel::NameIndex::Add(const string& name, const string& vendor, RteDeviceItem::TYPE type, RteItem* item)
+{
+  entries.push_back({ name, entries.size(), vendor, type, item });
+  if(WildCards::IsWildcardPattern(name)) {
+    bNamePatterns = true;
+  }
+}
+
+void RteModel::NameIndex::Sort()
+{
+  sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+    return a.name < b.name || (a.name == b.name && a.order < b.order);
+  });
+}
+
+void RteModel::NameIndex::Find(const string& pattern, bool bSymmetric, vector<const Entry*>& found) const
+{
+  auto itBegin = entries.begin();
+  auto itEnd = entries.end();
+  if(!pattern.empty() && !(bSymmetric && bNamePatterns)) {
+    // any matching name starts with the literal part of the pattern
+    const string prefix = pattern.substr(0, pattern.find_first_of("*?[]^|\\"));
+    itBegin = lower_bound(entries.begin(), entries.end(), prefix,
+      [](const Entry& e, const string& p) { return e.name < p; });
+    itEnd = find_if(itBegin, entries.end(),
+      [&prefix](const Entry& e) { return e.name.compare(0, prefix.size(), prefix) != 0; });
+  }
+  for(auto it = itBegin; it != itEnd; ++it) {
+    if(pattern.empty() || (bSymmetric ? WildCards::Match(pattern, it->name) : WildCards::MatchToPattern(it->name, pattern))) {
+      found.push_back(&(*it));
+    }
+  }
+  sort(found.begin(), found.end(), [](const Entry* a, const Entry* b) { return a->order < b->order; });
+}
+
 void RteModel::GetBoardBooks(map<string, string>& books, const string& device, const string& vendor) const
 {
   if(m_boards.empty())
@@ -817,6 +975,7 @@ RteGlobalModel::RteGlobalModel() :
   m_packRegistry(new RtePackRegistry()),
   m_nActiveProjectId(-1)
 {
+  m_packRegistry->SetConditionResultCache(&GetConditionResultCache());
 }
 RteGlobalModel::~RteGlobalModel()
 {
@@ -834,6 +993,8 @@ void RteGlobalModel::ClearModel()
 {
   ClearProjectTargets();
   RteModel::ClearModel();
+  // new packs use a new string pool, the previous one is released with the last item referring to it
+  XmlAttributes::ClearPool();
 }
 
 bool RteGlobalModel::PurgeModel(bool purgeExplicit) {
@@ -0,0 +1,460 @@
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RtePackCache.cpp
+* @brief CMSIS RTE Data Model : binary cache of parsed pdsc files
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2025-2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+#include "RtePackCache.h"
+
+#include "RteFsUtils.h"
+#include "RteUtils.h"
+#include "XmlItemArena.h"
+#include "XML_InputSourceReaderMappedFile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+// cache file layout:
+//   magic, parser information, pdsc file size, pdsc modification time, pdsc content hash, pdsc file name, stream size, stream
+// stream consists of recorded builder calls: operation code followed by its arguments
+static constexpr char CACHE_MAGIC[] = "RTEPACK2";
+static constexpr size_t CACHE_MAGIC_SIZE = sizeof(CACHE_MAGIC) - 1;
+static constexpr size_t CACHE_HEADER_MAX_SIZE = 16 * 1024; // read by Prune(), file names and parser information are short
+
+static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+enum CacheOp : uint8_t {
+  OP_PRE_CREATE = 1,
+  OP_CREATE,
+  OP_LINE,
+  OP_ATTRIBUTE,
+  OP_ADD,
+  OP_TEXT,
+  OP_POST_CREATE
+};
+
+namespace {
+
+template<typename T>
+void WriteValue(string& stream, T value) {
+  stream.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void WriteString(string& stream, const string& s) {
+  WriteValue<uint32_t>(stream, static_cast<uint32_t>(s.size()));
+  stream.append(s);
+}
+
+/**
+ * @brief bounds-checked reader over a binary buffer
+*/
+class CacheReader
+{
+public:
+  CacheReader(const string& buffer, size_t pos = 0) : m_buffer(buffer), m_pos(pos) {}
+
+  bool AtEnd() const { return m_pos >= m_buffer.size(); }
+  size_t GetPos() const { return m_pos; }
+
+  template<typename T>
+  bool ReadValue(T& value) {
+    if(m_buffer.size() - m_pos < sizeof(T)) {
+      return false;
+    }
+    memcpy(&value, m_buffer.data() + m_pos, sizeof(T));
+    m_pos += sizeof(T);
+    return true;
+  }
+
+  bool ReadString(string& s) {
+    uint32_t size = 0;
+    if(!ReadValue(size) || m_buffer.size() - m_pos < size) {
+      return false;
+    }
+    s.assign(m_buffer, m_pos, size);
+    m_pos += size;
+    return true;
+  }
+
+  bool SkipString() {
+    uint32_t size = 0;
+    if(!ReadValue(size) || m_buffer.size() - m_pos < size) {
+      return false;
+    }
+    m_pos += size;
+    return true;
+  }
+
+private:
+  const string& m_buffer;
+  size_t m_pos;
+};
+
+struct CacheHeader {
+  string parserInfo;
+  uint64_t fileSize = 0;
+  int64_t fileTime = 0;
+  uint64_t hash = 0;
+  string fileName;
+  uint64_t streamSize = 0;
+};
+
+bool ReadHeader(CacheReader& reader, CacheHeader& header) {
+  return reader.ReadString(header.parserInfo) && reader.ReadValue(header.fileSize) && reader.ReadValue(header.fileTime) &&
+    reader.ReadValue(header.hash) && reader.ReadString(header.fileName) && reader.ReadValue(header.streamSize);
+}
+
+int64_t FileTimeToInt(const fs::file_time_type& t) {
+  return static_cast<int64_t>(t.time_since_epoch().count());
+}
+
+uint64_t UpdateHash(uint64_t hash, const char* data, size_t len) {
+  for(size_t i = 0; i < len; i++) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+} // namespace
+
+void RtePackCacheRecorder::Clear(bool bDeleteContent)
+{
+  IXmlItemBuilder::Clear(bDeleteContent);
+  m_stream.clear();
+  m_builder->Clear(bDeleteContent);
+}
+
+void RtePackCacheRecorder::SetFileName(const string& fileName)
+{
+  IXmlItemBuilder::SetFileName(fileName);
+  m_builder->SetFileName(fileName);
+}
+
+bool RtePackCacheRecorder::CreateItem(const string& tag)
+{
+  WriteValue<uint8_t>(m_stream, OP_CREATE);
+  WriteString(m_stream, tag);
+  return m_builder->CreateItem(tag);
+}
+
+void RtePackCacheRecorder::AddItem()
+{
+  WriteValue<uint8_t>(m_stream, OP_ADD);
+  m_builder->AddItem();
+}
+
+void RtePackCacheRecorder::AddAttribute(const string& key, const string& value)
+{
+  WriteValue<uint8_t>(m_stream, OP_ATTRIBUTE);
+  WriteString(m_stream, key);
+  WriteString(m_stream, value);
+  m_builder->AddAttribute(key, value);
+}
+
+void RtePackCacheRecorder::SetText(const string& text)
+{
+  WriteValue<uint8_t>(m_stream, OP_TEXT);
+  WriteString(m_stream, text);
+  m_builder->SetText(text);
+}
+
+void RtePackCacheRecorder::PreCreateItem()
+{
+  WriteValue<uint8_t>(m_stream, OP_PRE_CREATE);
+  m_builder->PreCreateItem();
+}
+
+void RtePackCacheRecorder::PostCreateItem(bool success)
+{
+  WriteValue<uint8_t>(m_stream, OP_POST_CREATE);
+  WriteValue<uint8_t>(m_stream, success ? 1 : 0);
+  m_builder->PostCreateItem(success);
+}
+
+void RtePackCacheRecorder::SetLineNumber(int lineNumber)
+{
+  WriteValue<uint8_t>(m_stream, OP_LINE);
+  WriteValue<int32_t>(m_stream, lineNumber);
+  m_builder->SetLineNumber(lineNumber);
+}
+
+uint64_t RtePackCache::CalcHash(const string& buffer)
+{
+  return UpdateHash(FNV_OFFSET_BASIS, buffer.data(), buffer.size());
+}
+
+bool RtePackCache::CalcFileHash(const string& fileName, uint64_t& size, uint64_t& hash)
+{
+  XmlTypes::InputSource_t source = {};
+  source.fileName = fileName;
+  XML_InputSourceReaderMappedFile reader;
+  if(reader.Open(&source) != XmlTypes::Err::ERR_NOERR) {
+    return false;
+  }
+  size = 0;
+  hash = FNV_OFFSET_BASIS;
+  vector<char> chunk;
+  for(;;) {
+    // mapped files are handed out at once, others are read in chunks
+    const char* data = nullptr;
+    size_t len = 0;
+    if(!reader.ReadBuffer(data, len)) {
+      chunk.resize(64 * 1024);
+      len = reader.ReadLine(chunk.data(), chunk.size());
+      data = chunk.data();
+    }
+    if(len == 0) {
+      break;
+    }
+    hash = UpdateHash(hash, data, len);
+    size += len;
+  }
+  reader.Close();
+  return true;
+}
+
+string RtePackCache::GetCacheFileName(const string& pdscFile) const
+{
+  stringstream ss;
+  ss << m_cacheDir << '/' << RteUtils::ExtractFileBaseName(pdscFile) << '.' << hex << CalcHash(pdscFile) << ".bin";
+  return ss.str();
+}
+
+bool RtePackCache::Load(const string& pdscFile, IXmlItemBuilder* builder) const
+{
+  string buffer;
+  if(m_cacheDir.empty() || !builder || !RteFsUtils::ReadFile(GetCacheFileName(pdscFile), buffer)) {
+    return false;
+  }
+  if(buffer.compare(0, CACHE_MAGIC_SIZE, CACHE_MAGIC) != 0) {
+    return false;
+  }
+  CacheReader reader(buffer, CACHE_MAGIC_SIZE);
+  CacheHeader header;
+  if(!ReadHeader(reader, header) || header.parserInfo != m_parserInfo || header.fileName != pdscFile ||
+    buffer.size() - reader.GetPos() != header.streamSize) {
+    return false;
+  }
+  error_code ec;
+  if(fs::file_size(pdscFile, ec) != header.fileSize || ec) {
+    return false;
+  }
+  if(FileTimeToInt(RteFsUtils::GetModificationTime(pdscFile)) != header.fileTime) {
+    // file is touched, check if content is still the same
+    uint64_t size = 0, hash = 0;
+    if(!CalcFileHash(pdscFile, size, hash) || size != header.fileSize || hash != header.hash) {
+      return false;
+    }
+  }
+
+  // validate stream before creating any item
+  const size_t streamPos = reader.GetPos();
+  int depth = 0;
+  bool hasItems = false;
+  while(!reader.AtEnd()) {
+    uint8_t op = 0;
+    uint8_t success = 0;
+    int32_t line = 0;
+    reader.ReadValue(op);
+    bool ok = true;
+    switch(op) {
+    case OP_PRE_CREATE:
+      depth++;
+      hasItems = true;
+      break;
+    case OP_POST_CREATE:
+      ok = --depth >= 0 && reader.ReadValue(success);
+      break;
+    case OP_CREATE:
+    case OP_TEXT:
+      ok = reader.SkipString();
+      break;
+    case OP_ATTRIBUTE:
+      ok = reader.SkipString() && reader.SkipString();
+      break;
+    case OP_LINE:
+      ok = reader.ReadValue(line);
+      break;
+    case OP_ADD:
+      break;
+    default:
+      ok = false;
+      break;
+    }
+    if(!ok) {
+      return false;
+    }
+  }
+  if(depth != 0 || !hasItems) {
+    return false;
+  }
+
+  // replay, created items share one arena like parsed ones
+  XmlItemArena::Scope arenaScope;
+  builder->Clear();
+  builder->SetFileName(pdscFile);
+  CacheReader replay(buffer, streamPos);
+  string s1, s2;
+  while(!replay.AtEnd()) {
+    uint8_t op = 0;
+    uint8_t success = 0;
+    int32_t line = 0;
+    replay.ReadValue(op);
+    switch(op) {
+    case OP_PRE_CREATE:
+      builder->PreCreateItem();
+      break;
+    case OP_POST_CREATE:
+      replay.ReadValue(success);
+      builder->PostCreateItem(success != 0);
+      break;
+    case OP_CREATE:
+      replay.ReadString(s1);
+      builder->CreateItem(s1);
+      break;
+    case OP_TEXT:
+      replay.ReadString(s1);
+      builder->SetText(s1);
+      break;
+    case OP_ATTRIBUTE:
+      replay.ReadString(s1);
+      replay.ReadString(s2);
+      builder->AddAttribute(s1, s2);
+      break;
+    case OP_LINE:
+      replay.ReadValue(line);
+      builder->SetLineNumber(line);
+      break;
+    case OP_ADD:
+      builder->AddItem();
+      break;
+    default:
+      break;
+    }
+  }
+  return true;
+}
+
+bool RtePackCache::Save(const string& pdscFile, const fs::file_time_type& fileTime,
+  const RtePackCacheRecorder& recorder) const
+{
+  if(m_cacheDir.empty() || recorder.GetStream().empty()) {
+    return false;
+  }
+  // the recorded calls describe the file content only if it is unchanged since parsing started
+  uint64_t size = 0, hash = 0;
+  if(RteFsUtils::GetModificationTime(pdscFile) != fileTime || !CalcFileHash(pdscFile, size, hash) || size == 0) {
+    return false;
+  }
+  if(!RteFsUtils::CreateDirectories(m_cacheDir)) {
+    return false;
+  }
+  string header(CACHE_MAGIC, CACHE_MAGIC_SIZE);
+  WriteString(header, m_parserInfo);
+  WriteValue<uint64_t>(header, size);
+  WriteValue<int64_t>(header, FileTimeToInt(fileTime));
+  WriteValue<uint64_t>(header, hash);
+  WriteString(header, pdscFile);
+  WriteValue<uint64_t>(header, recorder.GetStream().size());
+
+  // write to a temporary file first to avoid reading partially written cache by concurrent processes
+  const string cacheFile = GetCacheFileName(pdscFile);
+  const string tmpFile = RteFsUtils::CreateTemporaryName(cacheFile);
+  {
+    ofstream out(tmpFile, ios::binary | ios::trunc);
+    if(!out.is_open()) {
+      return false;
+    }
+    out.write(header.data(), header.size());
+    out.write(recorder.GetStream().data(), recorder.GetStream().size());
+    if(!out.good()) {
+      out.close();
+      RteFsUtils::RemoveFile(tmpFile);
+      return false;
+    }
+  }
+  error_code ec;
+  fs::rename(tmpFile, cacheFile, ec);
+  if(ec) {
+    RteFsUtils::RemoveFile(tmpFile);
+    return false;
+  }
+  return true;
+}
+
+void RtePackCache::Prune(uint64_t maxSize) const
+{
+  error_code ec;
+  if(m_cacheDir.empty() || !fs::is_directory(m_cacheDir, ec)) {
+    return;
+  }
+  struct CacheFile {
+    fs::path path;
+    fs::file_time_type time;
+    uint64_t size;
+  };
+  vector<CacheFile> files;
+  const fs::file_time_type now = fs::file_time_type::clock::now();
+  for(auto& entry : fs::directory_iterator(m_cacheDir, ec)) {
+    if(!entry.is_regular_file(ec)) {
+      continue;
+    }
+    if(entry.path().extension() == ".tmp") {
+      // left over by an interrupted Save(), recent ones can still be written by a concurrent process
+      if(now - entry.last_write_time(ec) > chrono::hours(1) && !ec) {
+        fs::remove(entry.path(), ec);
+      }
+      continue;
+    }
+    if(entry.path().extension() != ".bin") {
+      continue;
+    }
+    // keep files of existing pdsc files, files of another parser are overwritten or pruned by age
+    string buffer(CACHE_HEADER_MAX_SIZE, '\0');
+    ifstream in(entry.path(), ios::binary);
+    in.read(&buffer[0], buffer.size());
+    buffer.resize(static_cast<size_t>(in.gcount()));
+    in.close();
+    CacheReader reader(buffer, CACHE_MAGIC_SIZE);
+    CacheHeader header;
+    if(buffer.compare(0, CACHE_MAGIC_SIZE, CACHE_MAGIC) != 0 || !ReadHeader(reader, header) ||
+      !fs::exists(header.fileName, ec)) {
+      fs::remove(entry.path(), ec);
+      continue;
+    }
+    files.push_back({ entry.path(), entry.last_write_time(ec), entry.file_size(ec) });
+  }
+  uint64_t totalSize = 0;
+  for(auto& f : files) {
+    totalSize += f.size;
+  }
+  if(totalSize <= maxSize) {
+    return;
+  }
+  sort(files.begin(), files.end(), [](const CacheFile& a, const CacheFile& b) { return a.time < b.time; });
+  for(auto& f : files) {
+    if(totalSize <= maxSize) {
+      break;
+    }
+    if(fs::remove(f.path, ec)) {
+      totalSize -= f.size;
+    }
+  }
+}
+
+// end of RtePackCache.cpp
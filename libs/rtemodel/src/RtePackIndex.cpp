@@ -0,0 +1,253 @@
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file RtePackIndex.cpp
+* @brief CMSIS RTE Data Model : persistent index of packs installed in CMSIS_PACK_ROOT
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+#include "RtePackIndex.h"
+
+#include "RtePackage.h"
+
+#include "RteFsUtils.h"
+#include "RteUtils.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+// index file layout, one tab-separated record per line:
+//   magic, pack root
+//   'D', directory modification time, directory
+//   'P', pdsc modification time, loaded flag, pack ID, pdsc file
+static constexpr const char* INDEX_MAGIC = "RTEPACKIDX2";
+
+namespace {
+
+int64_t FileTimeToInt(const fs::file_time_type& t) {
+  return static_cast<int64_t>(t.time_since_epoch().count());
+}
+
+int64_t GetFileTime(const string& path) {
+  return FileTimeToInt(RteFsUtils::GetModificationTime(path));
+}
+
+bool StringToTime(const string& s, int64_t& t) {
+  char* end = nullptr;
+  t = strtoll(s.c_str(), &end, 10);
+  return !s.empty() && *end == '\0';
+}
+
+} // namespace
+
+RtePackIndex::RtePackIndex(const string& packRoot) :
+  m_packRoot(packRoot),
+  m_bModified(false)
+{
+}
+
+void RtePackIndex::Clear()
+{
+  m_entries.clear();
+  m_entryIndex.clear();
+  m_dirTimes.clear();
+}
+
+const RtePackIndex::Entry* RtePackIndex::GetEntry(const string& pdscFile) const
+{
+  auto it = m_entryIndex.find(pdscFile);
+  return it != m_entryIndex.end() ? &m_entries[it->second] : nullptr;
+}
+
+bool RtePackIndex::IsCurrent(const Entry& e)
+{
+  return e.bLoaded && e.pdscTime == GetFileTime(e.pdscFile);
+}
+
+bool RtePackIndex::IsValid() const
+{
+  if(m_dirTimes.empty()) {
+    return false;
+  }
+  for(auto& [dir, t] : m_dirTimes) {
+    if(GetFileTime(dir) != t) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void RtePackIndex::Scan()
+{
+  vector<Entry> entries;
+  m_dirTimes.clear();
+  ScanDir(m_packRoot, 3, entries);
+  // keep pack information for files found again unmodified
+  for(auto& e : entries) {
+    const Entry* existing = GetEntry(e.pdscFile);
+    if(existing && IsCurrent(*existing)) {
+      e = *existing;
+    }
+  }
+  m_entries.clear();
+  m_entryIndex.clear();
+  for(auto& e : entries) {
+    if(m_entryIndex.find(e.pdscFile) == m_entryIndex.end()) {
+      m_entryIndex[e.pdscFile] = m_entries.size();
+      m_entries.push_back(std::move(e));
+    }
+  }
+  m_bModified = true;
+}
+
+void RtePackIndex::ScanDir(const string& dir, int depth, vector<Entry>& entries)
+{
+  // follows RteFsUtils::GetMatchingFiles() with bAlwaysSearchSubfolders = false
+  error_code ec;
+  fs::path folder = RteFsUtils::AbsolutePath(dir);
+  if(!fs::exists(folder, ec) || !fs::is_directory(folder, ec)) {
+    return;
+  }
+  // time is taken before listing: changes made while scanning invalidate the index
+  const int64_t dirTime = GetFileTime(folder.generic_string());
+  RteFsUtils::PathVec dirs;
+  bool bFound = false;
+  for(auto& entry : fs::directory_iterator(folder, ec)) {
+    const fs::path& p = entry.path();
+    string filename = p.filename().generic_string();
+    if(fs::is_regular_file(p, ec)) {
+      auto pos = filename.rfind(".pdsc");
+      if(pos != string::npos && pos == (filename.size() - 5)) {
+        Entry e;
+        e.pdscFile = p.generic_string();
+        e.id = RtePackage::PackIdFromPath(e.pdscFile);
+        entries.push_back(std::move(e));
+        bFound = true;
+      }
+    } else if(depth > 0 && fs::is_directory(p, ec) && filename.find('.') != 0) {
+      dirs.push_back(p.generic_string());
+    }
+  }
+  if(bFound) {
+    // pack directory: pdsc files are not added or removed without adding or removing the directory itself
+    return;
+  }
+  // directories with no pdsc are watched for added pdsc files or subdirectories
+  m_dirTimes[folder.generic_string()] = dirTime;
+  if(depth <= 0) {
+    return;
+  }
+  depth--;
+  for(auto& p : dirs) {
+    ScanDir(p.generic_string(), depth, entries);
+  }
+}
+
+bool RtePackIndex::UpdateEntry(RtePackage* pack)
+{
+  if(!pack) {
+    return false;
+  }
+  auto it = m_entryIndex.find(pack->GetPackageFileName());
+  if(it == m_entryIndex.end()) {
+    return false;
+  }
+  Entry& e = m_entries[it->second];
+  const int64_t pdscTime = FileTimeToInt(pack->GetModificationTime());
+  if(e.bLoaded && e.pdscTime == pdscTime) {
+    return false;
+  }
+  // version as given in the pdsc file, pack ID is composed with SemVer
+  e.id = RtePackage::ComposePackageID(pack->GetVendorString(), pack->GetName(), pack->GetVersionString());
+  e.pdscTime = pdscTime;
+  e.bLoaded = true;
+  m_bModified = true;
+  return true;
+}
+
+bool RtePackIndex::Load(const string& indexFile)
+{
+  Clear();
+  m_bModified = false;
+  ifstream in(indexFile);
+  if(!in.is_open()) {
+    return false;
+  }
+  string line;
+  if(!getline(in, line) || line != string(INDEX_MAGIC) + '\t' + m_packRoot) {
+    return false;
+  }
+  bool success = true;
+  int64_t t = 0;
+  while(success && getline(in, line)) {
+    list<string> segments;
+    RteUtils::SplitString(segments, line, '\t');
+    const vector<string> fields(segments.begin(), segments.end());
+    const string tag = fields.empty() ? RteUtils::EMPTY_STRING : fields[0];
+    if(tag == "D" && fields.size() == 3 && StringToTime(fields[1], t)) {
+      m_dirTimes[fields[2]] = t;
+    } else if(tag == "P" && fields.size() == 5 && StringToTime(fields[1], t) &&
+      m_entryIndex.find(fields[4]) == m_entryIndex.end()) {
+      m_entryIndex[fields[4]] = m_entries.size();
+      Entry& e = m_entries.emplace_back();
+      e.pdscTime = t;
+      e.bLoaded = fields[2] == "1";
+      e.id = fields[3];
+      e.pdscFile = fields[4];
+    } else {
+      success = false;
+    }
+  }
+  if(!success || m_dirTimes.empty()) {
+    Clear();
+    return false;
+  }
+  return true;
+}
+
+bool RtePackIndex::Save(const string& indexFile)
+{
+  if(!RteFsUtils::CreateDirectories(RteUtils::ExtractFilePath(indexFile, false))) {
+    return false;
+  }
+  stringstream ss;
+  ss << INDEX_MAGIC << '\t' << m_packRoot << '\n';
+  for(auto& [dir, t] : m_dirTimes) {
+    ss << "D\t" << t << '\t' << dir << '\n';
+  }
+  for(auto& e : m_entries) {
+    ss << "P\t" << e.pdscTime << '\t' << (e.bLoaded ? 1 : 0) << '\t' << e.id << '\t' << e.pdscFile << '\n';
+  }
+  // write to a temporary file first to avoid reading partially written index by concurrent processes
+  const string tmpFile = RteFsUtils::CreateTemporaryName(indexFile);
+  {
+    ofstream out(tmpFile, ios::trunc);
+    if(!out.is_open()) {
+      return false;
+    }
+    out << ss.str();
+    if(!out.good()) {
+      out.close();
+      RteFsUtils::RemoveFile(tmpFile);
+      return false;
+    }
+  }
+  error_code ec;
+  fs::rename(tmpFile, indexFile, ec);
+  if(ec) {
+    RteFsUtils::RemoveFile(tmpFile);
+    return false;
+  }
+  m_bModified = false;
+  return true;
+}
+
+// end of RtePackIndex.cpp
@@ -284,9 +284,26 @@ int RtePackage::ComparePackageIDs(const string& a, const string& b)
     return res;
   }
 
-  string verA = RtePackage::VersionFromId(a);
-  string verB = RtePackage::VersionFromId(b);
-  return VersionCmp::Compare(verB, verA); // reverse comparison!
+  // compare versions in place, VersionFromId() is only needed for versions without minor or patch segment
+  string semVerA, semVerB;
+  VersionCmp::Key verA(VersionViewFromId(a, semVerA));
+  VersionCmp::Key verB(VersionViewFromId(b, semVerB));
+  return verB.Compare(verA); // reverse comparison!
+}
+
+string_view RtePackage::VersionViewFromId(const string& id, string& buf)
+{
+  string::size_type pos = id.find_last_of(RteConstants::PREFIX_PACK_VERSION_CHAR);
+  if (pos == string::npos) {
+    return string_view();
+  }
+  string_view version = string_view(id).substr(pos + 1);
+  string_view release = version.substr(0, version.find_first_of("-+"));
+  if (count(release.begin(), release.end(), '.') < 2) {
+    buf = VersionCmp::ToSemVer(string(version));
+    return buf;
+  }
+  return version;
 }
 
 int RtePackage::ComparePdscFileNames(const std::string& pdsc1, const std::string& pdsc2)
@@ -496,7 +513,7 @@ RteComponent* RtePackage::FindComponents(const RteItem& item, list<RteComponent*
   return m_components ? m_components->FindComponents(item, components) : nullptr;
 }
 
-RteApi* RtePackage::GetApi(const map<string, string>& componentAttributes) const
+RteApi* RtePackage::GetApi(const XmlAttributes& componentAttributes) const
 {
   if (m_apis) {
     map<string, RteApi*>::const_iterator it;
@@ -741,6 +758,7 @@ string RtePackage::ConstructID()
 
   string id = RtePackage::GetPackageIDfromAttributes(*this, true);
   m_commonID = RtePackage::GetPackageIDfromAttributes(*this, false);
+  m_versionKey = VersionCmp::Key(GetVersionString());
 
   m_nDeprecated = IsDeprecated() ? 1 : 0;
   m_nDominating = !m_nDeprecated && GetItemByTag("dominate") != nullptr;
@@ -1471,7 +1489,8 @@ RtePackageAggregate* RtePackFamilyCollection::EnsurePackageAggregate(const std::
 
 
 // -------------------------------------
-RtePackRegistry::RtePackRegistry()
+RtePackRegistry::RtePackRegistry() :
+  m_conditionResultCache(nullptr)
 {
 }
 
@@ -1488,6 +1507,15 @@ void RtePackRegistry::Clear()
     delete p;
   }
   m_loadedPacks.clear();
+  ClearConditionResults();
+}
+
+void RtePackRegistry::ClearConditionResults()
+{
+  // results of deleted items must not be found by items allocated at the same address
+  if(m_conditionResultCache) {
+    m_conditionResultCache->Clear();
+  }
 }
 
 
@@ -1506,6 +1534,7 @@ bool RtePackRegistry::AddPack(RtePackage* pack, bool bReplace)
   if(existing) {
     if(bReplace || (pack->GetModificationTime() > existing->GetModificationTime())) {
       delete existing;
+      ClearConditionResults();
     } else {
       return false;
     }
@@ -1520,6 +1549,7 @@ bool RtePackRegistry::ErasePack(const std::string& pdscFile)
   if(it != m_loadedPacks.end()) {
     delete it->second;
     m_loadedPacks.erase(it);
+    ClearConditionResults();
     return true;
   }
   return false;
@@ -316,7 +316,7 @@ RteComponentInstance* RteProject::GetComponentInstance(const string& id) const
 }
 
 
-RteComponentInstance* RteProject::GetApiInstance(const map<string, string>& componentAttributes) const
+RteComponentInstance* RteProject::GetApiInstance(const XmlAttributes& componentAttributes) const
 {
   for (auto [_, ci] : m_components) {
     if (ci && ci->IsApi() && ci->MatchApiAttributes(componentAttributes))
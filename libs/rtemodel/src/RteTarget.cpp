@@ -70,6 +70,8 @@ RteTarget::RteTarget(RteItem* parent, RteModel* filteredModel, const string& nam
   RteItem(parent),
   m_filteredModel(filteredModel),
   m_bTargetSupported(false), // by default not supported
+  m_filterContext(0),
+  m_dependencySolver(0),
   m_effectiveDevicePackage(0),
   m_deviceStartupComponent(0),
   m_device(0),
@@ -229,11 +231,12 @@ bool RteTarget::IsComponentFiltered(RteComponent* c) const {
   return false;
 }
 
-RteItem::ConditionResult RteTarget::GetComponents(const map<string, string>& componentAttributes, set<RteComponent*>& components) const
+RteItem::ConditionResult RteTarget::GetComponents(const XmlAttributes& componentAttributes, set<RteComponent*>& components) const
 {
   RteItem::ConditionResult result = RteItem::MISSING;
-  for (auto it = m_filteredComponents.begin(); it != m_filteredComponents.end(); ++it) {
-    RteComponent* c = it->second;
+  vector<RteComponent*> candidates;
+  m_filteredComponentIndex.GetCandidates(componentAttributes, candidates);
+  for (RteComponent* c : candidates) {
     if (c->MatchComponentAttributes(componentAttributes)) {
       components.insert(c);
       if (IsComponentSelected(c)) {
@@ -583,6 +586,10 @@ void RteTarget::ProcessAttributes() // called from SetAttributes(), AddAttribute
   if (m_bDestroy)
     return;
 
+  // shared results belong to previous attributes
+  if (m_filterContext)
+    m_filterContext->SetSharedResults(nullptr);
+
   // set empty board name to filter-out board-specific items if device is selected
   if(HasAttribute("Dname") &&
     !HasAttribute("Bname")) {
@@ -1162,6 +1169,7 @@ void RteTarget::ClearFilteredComponents()
 {
   m_potentialComponents.clear();
   m_filteredComponents.clear();
+  m_filteredComponentIndex.Clear();
   m_filteredBundles.clear();
   m_filteredApis.clear();
   m_filteredFiles.clear();
@@ -1200,7 +1208,7 @@ RteComponent* RteTarget::GetLatestPotentialComponent(const string& id) const
   return NULL;
 }
 
-RteApi* RteTarget::GetApi(const map<string, string>& componentAttributes) const
+RteApi* RteTarget::GetApi(const XmlAttributes& componentAttributes) const
 {
   RteProject* p = GetProject();
   if (p) {
@@ -1309,7 +1317,7 @@ void RteTarget::AddFilteredComponent(RteComponent* c)
     }
 
     // check pack version, not component version !
-    if (VersionCmp::Compare(pack->GetVersionString(), insertedPack->GetVersionString()) < 0)
+    if (pack->GetVersionKey().Compare(insertedPack->GetVersionKey()) < 0)
       return; // the inserted component comes from newer package
   }
 
@@ -1322,9 +1330,7 @@ void RteTarget::AddPotentialComponent(RteComponent* c)
   RtePackage* pack = c->GetPackage();
   RteComponent* inserted = GetPotentialComponent(id);
   if (inserted && pack) {
-    const string& packVersion = pack->GetVersionString();
-    const string& insertedPackVersion = inserted->GetPackage()->GetVersionString();
-    if (VersionCmp::Compare(packVersion, insertedPackVersion) < 0)
+    if (pack->GetVersionKey().Compare(inserted->GetPackage()->GetVersionKey()) < 0)
       return; // the inserted component comes from newer package
   }
   m_potentialComponents[id] = c;
@@ -1356,6 +1362,8 @@ void RteTarget::UpdateFilterModel()
   m_effectiveDevicePackage = m_filteredModel->FilterModel(globalModel, GetDevicePackage());
   if (m_effectiveDevicePackage != GetDevicePackage())
     ProcessAttributes(); // updates device
+  // reuse filter results of other targets with the same attributes
+  m_filterContext->SetSharedResults(globalModel->GetConditionResultCache().GetResults(GetAttributes()));
   FilterComponents();
 }
 
@@ -1389,6 +1397,7 @@ void RteTarget::FilterComponents()
       AddFilteredComponent(c);
     }
   }
+  m_filteredComponentIndex.Build(m_filteredComponents);
   // categorize component, add bundle and filter files
   for (auto [_, c] : m_filteredComponents) {
     RteApi* a = GetApi(c->GetAttributes());
@@ -1706,7 +1715,9 @@ RteItem::ConditionResult RteTarget::GetComponentsForApi(RteApi* api, set<RteComp
   ConditionResult result = MISSING;
   auto& apiAttributes = api->GetAttributes();
   int nSelected = 0;
-  for (auto [id, c] : m_filteredComponents) {
+  vector<RteComponent*> candidates;
+  m_filteredComponentIndex.GetCandidates(apiAttributes, candidates);
+  for (RteComponent* c : candidates) {
     if (c->MatchComponentAttributes(apiAttributes, false)) {
       if (IsComponentSelected(c)) {
         components.insert(c);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -10,6 +10,8 @@
 #include "RteKernelSlim.h"
 #include "RteCprjProject.h"
 
+#include <thread>
+
 using namespace std;
 
 class RteConditionTest : public RteModelTestConfig {
@@ -47,6 +49,244 @@ TEST(RteConditionValidateTest, Validate)
   EXPECT_FALSE(deviceExpression.Validate());
 }
 
+TEST_F(RteConditionTest, SharedFilterResults) {
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  RteCprjProject* loadedCprjProject = rteKernel.LoadCprj(RteTestM3_cprj);
+  ASSERT_NE(loadedCprjProject, nullptr);
+  RteTarget* activeTarget = loadedCprjProject->GetActiveTarget();
+  ASSERT_NE(activeTarget, nullptr);
+  RteConditionContext* filterContext = activeTarget->GetFilterContext();
+  ASSERT_NE(filterContext, nullptr);
+
+  RteConditionResultCache& cache = activeTarget->GetModel()->GetConditionResultCache();
+  XmlAttributes attributes = activeTarget->GetAttributes();
+  RteConditionResultCache::Results* results = cache.GetResults(attributes);
+  ASSERT_NE(results, nullptr);
+  // C-attributes are not used by filtering
+  attributes.set("Cclass", "Any");
+  EXPECT_EQ(cache.GetResults(attributes), results);
+  attributes.set("Dname", "Other");
+  EXPECT_NE(cache.GetResults(attributes), results);
+
+  // shared results are filled by component filtering and equal to results of an independent context
+  RteConditionContext independentContext(activeTarget);
+  size_t count = 0;
+  for (auto [_, c] : activeTarget->GetFilteredComponents()) {
+    RteCondition* condition = c->GetCondition();
+    RteItem::ConditionResult res = condition ? results->Get(condition) : RteItem::UNDEFINED;
+    if (res == RteItem::UNDEFINED) {
+      continue; // no condition or evaluated while filtering the model
+    }
+    EXPECT_EQ(res, filterContext->GetConditionResult(condition));
+    EXPECT_EQ(res, independentContext.Evaluate(condition));
+    count++;
+  }
+  EXPECT_TRUE(count > 0);
+}
+
+TEST_F(RteConditionTest, SharedFilterResultsPackReload) {
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteFsUtils::AbsolutePath(packsDir).generic_string());
+  RteCprjProject* loadedCprjProject = rteKernel.LoadCprj(RteTestM3_cprj);
+  ASSERT_NE(loadedCprjProject, nullptr);
+  RteTarget* activeTarget = loadedCprjProject->GetActiveTarget();
+  ASSERT_NE(activeTarget, nullptr);
+  RteModel* globalModel = rteKernel.GetGlobalModel();
+  RteConditionResultCache::Results* results = globalModel->GetConditionResultCache().GetResults(activeTarget->GetAttributes());
+  ASSERT_NE(results, nullptr);
+
+  RtePackageInstanceInfo packInfo(nullptr, "ARM::RteTest@0.1.0");
+  RtePackage* pack = globalModel->GetPackage(packInfo);
+  ASSERT_NE(pack, nullptr);
+  RteCondition* condition = pack->GetCondition("CM3");
+  ASSERT_NE(condition, nullptr);
+  RteConditionContext context(activeTarget);
+  context.SetSharedResults(results);
+  EXPECT_EQ(context.Evaluate(condition), RteItem::FULFILLED);
+  EXPECT_EQ(results->Get(condition), RteItem::FULFILLED);
+
+  // modify the condition and reload the pack
+  const string pdscFile = pack->GetPackageFileName();
+  string buf;
+  EXPECT_TRUE(RteFsUtils::ReadFile(pdscFile, buf));
+  RteUtils::ReplaceAll(buf, "<condition id=\"CM3\">", "<condition id=\"CM3\"><deny Dcore=\"Cortex-M3\"/>");
+  EXPECT_TRUE(RteFsUtils::CopyBufferToFile(pdscFile, buf, false));
+  EXPECT_TRUE(pack->SetModificationTime(pack->GetModificationTime() - chrono::seconds(5)));
+  list<RtePackage*> packs;
+  list<string> pdscFiles = { pdscFile };
+  EXPECT_TRUE(rteKernel.LoadAndInsertPacks(packs, pdscFiles));
+
+  // results of the replaced pack are dropped together with the targets
+  EXPECT_EQ(results->Get(condition), RteItem::UNDEFINED);
+  EXPECT_EQ(loadedCprjProject->GetActiveTarget(), nullptr);
+  pack = rteKernel.GetPackRegistry()->GetPack(pdscFile);
+  ASSERT_NE(pack, nullptr);
+  EXPECT_EQ(globalModel->GetPackage(packInfo), pack);
+
+  // the reloaded project evaluates the modified condition
+  loadedCprjProject = rteKernel.LoadCprj(RteTestM3_cprj);
+  ASSERT_NE(loadedCprjProject, nullptr);
+  activeTarget = loadedCprjProject->GetActiveTarget();
+  ASSERT_NE(activeTarget, nullptr);
+  EXPECT_EQ(globalModel->GetConditionResultCache().GetResults(activeTarget->GetAttributes()), results);
+  condition = pack->GetCondition("CM3");
+  ASSERT_NE(condition, nullptr);
+  RteConditionContext reloadedContext(activeTarget);
+  reloadedContext.SetSharedResults(results);
+  EXPECT_EQ(reloadedContext.Evaluate(condition), RteItem::FAILED);
+  EXPECT_EQ(results->Get(condition), RteItem::FAILED);
+}
+
+TEST_F(RteConditionTest, ConcurrentEvaluation) {
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  RteCprjProject* loadedCprjProject = rteKernel.LoadCprj(RteTestM3_cprj);
+  ASSERT_NE(loadedCprjProject, nullptr);
+  RteTarget* activeTarget = loadedCprjProject->GetActiveTarget();
+  ASSERT_NE(activeTarget, nullptr);
+
+  // conditions of all loaded components, results of a sequential evaluation
+  vector<RteCondition*> conditions;
+  for (auto pack : rteKernel.GetPackRegistry()->GetLoadedPacks()) {
+    RteItem* components = pack.second->GetComponents();
+    if (!components) {
+      continue;
+    }
+    for (auto c : components->GetChildren()) {
+      RteCondition* condition = c->GetCondition();
+      if (condition) {
+        conditions.push_back(condition);
+      }
+    }
+  }
+  ASSERT_FALSE(conditions.empty());
+  vector<RteItem::ConditionResult> expected;
+  RteConditionContext sequentialContext(activeTarget);
+  for (auto condition : conditions) {
+    expected.push_back(sequentialContext.Evaluate(condition));
+  }
+
+  // conditions and devices of loaded packs are shared by contexts evaluated in parallel
+  const size_t nThreads = 4;
+  vector<vector<RteItem::ConditionResult> > results(nThreads);
+  vector<thread> threads;
+  for (size_t i = 0; i < nThreads; i++) {
+    threads.emplace_back([&, i]() {
+      RteConditionContext context(activeTarget);
+      for (auto condition : conditions) {
+        condition->IsDeviceDependent();
+        results[i].push_back(context.Evaluate(condition));
+      }
+      RteDeviceItem* device = activeTarget->GetDevice();
+      if (device) {
+        device->GetEffectiveProperties(RteUtils::EMPTY_STRING);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  for (auto& res : results) {
+    EXPECT_EQ(res, expected);
+  }
+}
+
+TEST_F(RteConditionTest, IncrementalDependencies) {
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  RteCprjProject* loadedCprjProject = rteKernel.LoadCprj(RteTestM3_cprj);
+  ASSERT_NE(loadedCprjProject, nullptr);
+  RteTarget* activeTarget = loadedCprjProject->GetActiveTarget();
+  ASSERT_NE(activeTarget, nullptr);
+  RteModel* rteModel = activeTarget->GetFilteredModel();
+  ASSERT_NE(rteModel, nullptr);
+  RteDependencySolver* depSolver = activeTarget->GetDependencySolver();
+  ASSERT_NE(depSolver, nullptr);
+
+  // incremental results must match a full evaluation of the same selection
+  auto compareWithFullEvaluation = [&]() {
+    RteDependencySolver fullSolver(activeTarget);
+    EXPECT_EQ(fullSolver.EvaluateDependencies(), depSolver->GetConditionResult());
+    for (auto [a, count] : activeTarget->GetSelectedComponentAggregates()) {
+      EXPECT_EQ(fullSolver.GetConditionResult(a), depSolver->GetConditionResult(a)) << a->GetComponentAggregateID();
+      RteComponent* c = a->GetComponent();
+      RteCondition* condition = c ? c->GetCondition() : nullptr;
+      if (condition) {
+        EXPECT_EQ(fullSolver.GetConditionResult(condition), depSolver->GetConditionResult(condition)) << condition->GetID();
+      }
+    }
+  };
+
+  const vector<map<string, string>> components = {
+    { {"Cclass","RteTest" }, {"Cgroup", "RequireDependency" }, {"Cversion","0.9.9"} },
+    { {"Cclass","RteTest" }, {"Cgroup", "GlobalFile" }, {"Cversion","0.0.3"} },
+    { {"Cclass","RteTest" }, {"Cgroup", "AcceptDependency" }, {"Cversion","0.9.9"} },
+    { {"Cclass","RteTest" }, {"Cgroup", "LocalFile" }, {"Cversion","0.0.3"} },
+    { {"Cclass","RteTestBundle" }, {"Cbundle","BundleOne" }, {"Cgroup", "G2" }, {"Cversion","1.1.0"} },
+  };
+  // aggregates with a different result or selection must be reported as changed
+  auto collectResults = [&]() {
+    map<RteComponentAggregate*, RteItem::ConditionResult> results;
+    for (auto [a, count] : activeTarget->GetSelectedComponentAggregates()) {
+      RteComponent* c = a->GetComponent();
+      RteCondition* condition = c ? c->GetCondition() : nullptr;
+      results[a] = condition ? depSolver->GetConditionResult(condition) : RteItem::IGNORED;
+    }
+    return results;
+  };
+
+  RteComponentInstance item(nullptr);
+  item.SetTag("component");
+  int incrementalChanges = 0;
+  for (int count : { 1, 0 }) {
+    for (auto& attributes : components) {
+      item.SetAttributes(attributes);
+      RteComponent* c = rteModel->FindFirstComponent(item);
+      ASSERT_NE(c, nullptr);
+      const size_t revision = depSolver->GetRevision();
+      const auto previousResults = collectResults();
+      activeTarget->SelectComponent(c, count, true);
+      compareWithFullEvaluation();
+
+      if (depSolver->GetRevision() == revision) {
+        EXPECT_EQ(collectResults(), previousResults); // selection is unchanged, no evaluation
+        continue;
+      }
+      if (!depSolver->HasChanges(revision)) {
+        continue; // complete evaluation
+      }
+      incrementalChanges++;
+      const set<RteComponentAggregate*> changed = depSolver->GetChangedAggregates(revision);
+      EXPECT_TRUE(changed.find(activeTarget->GetComponentAggregate(c)) != changed.end());
+      const auto results = collectResults();
+      for (auto& [a, res] : results) {
+        auto it = previousResults.find(a);
+        if (it == previousResults.end() || it->second != res) {
+          EXPECT_TRUE(changed.find(a) != changed.end()) << a->GetComponentAggregateID();
+        }
+      }
+      for (auto& [a, res] : previousResults) {
+        if (results.find(a) == results.end()) {
+          EXPECT_TRUE(changed.find(a) != changed.end()) << a->GetComponentAggregateID();
+        }
+      }
+      EXPECT_TRUE(depSolver->GetChangedAggregates(depSolver->GetRevision()).empty());
+    }
+  }
+  EXPECT_GT(incrementalChanges, 0);
+  depSolver->ResolveDependencies();
+  compareWithFullEvaluation();
+
+  // changes are unknown after a complete evaluation
+  const size_t revision = depSolver->GetRevision();
+  EXPECT_TRUE(depSolver->HasChanges(revision));
+  depSolver->Clear();
+  depSolver->EvaluateDependencies();
+  EXPECT_FALSE(depSolver->HasChanges(revision));
+  EXPECT_TRUE(depSolver->HasChanges(depSolver->GetRevision()));
+}
+
 TEST_F(RteConditionTest, MissingIgnoredFulfilledSelectable) {
   // load project to get a working target and condition contexts
   RteKernelSlim rteKernel;
@@ -293,6 +533,30 @@ TEST_F(RteConditionTest, MissingIgnoredFulfilledSelectable) {
   EXPECT_EQ(deviceExpression.Evaluate(filterContext), RteItem::FULFILLED);
   EXPECT_EQ(deviceExpression.Evaluate(depSolver), RteItem::IGNORED);
 
+  RteRequireExpression devicePatternExpression(nullptr);
+  devicePatternExpression.AddAttribute("Dvendor", "ARM");
+  devicePatternExpression.AddAttribute("Dname", "RteTest_*");
+  devicePatternExpression.ConstructID();
+  EXPECT_EQ(devicePatternExpression.Evaluate(filterContext), RteItem::FULFILLED);
+  // compiled predicates keep their own copies of attribute values
+  devicePatternExpression.ClearAttributes();
+  devicePatternExpression.AddAttribute("Dname", "Other*");
+  EXPECT_EQ(devicePatternExpression.Evaluate(filterContext), RteItem::FULFILLED);
+  devicePatternExpression.ConstructID();
+  EXPECT_EQ(devicePatternExpression.Evaluate(filterContext), RteItem::FAILED);
+
+  RteRequireExpression otherDeviceExpression(nullptr);
+  otherDeviceExpression.AddAttribute("Dvendor", "ARM");
+  otherDeviceExpression.AddAttribute("Dname", "Other*");
+  otherDeviceExpression.ConstructID();
+  EXPECT_EQ(otherDeviceExpression.Evaluate(filterContext), RteItem::FAILED);
+
+  RteRequireExpression otherVendorExpression(nullptr);
+  otherVendorExpression.AddAttribute("Dvendor", "Other");
+  otherVendorExpression.AddAttribute("Dname", "RteTest_*");
+  otherVendorExpression.ConstructID();
+  EXPECT_EQ(otherVendorExpression.Evaluate(filterContext), RteItem::FAILED);
+
   RteAcceptExpression componentExpression(nullptr);
   componentExpression.AddAttribute("Cclass", "MyClass");
   componentExpression.AddAttribute("Cgroup", "MyGroup");
@@ -146,6 +146,13 @@ TEST(RteItemTest, PackageID) {
   EXPECT_EQ(RtePackage::VersionFromId("Vendor::Name@1.2.3-alpha+build"), "1.2.3-alpha");
   EXPECT_EQ(RtePackage::VersionFromId(id), "1.2.3-alpha");
   EXPECT_TRUE(RtePackage::VersionFromId(commonId).empty());
+  string buf;
+  EXPECT_EQ(RtePackage::VersionViewFromId("Vendor::Name@1.2.3-alpha+build", buf), "1.2.3-alpha+build");
+  EXPECT_TRUE(buf.empty());
+  EXPECT_EQ(RtePackage::VersionViewFromId("Vendor::Name@1.2-alpha", buf), "1.2.0-alpha");
+  EXPECT_TRUE(RtePackage::VersionViewFromId(commonId, buf).empty());
+  EXPECT_TRUE(RtePackage::ComparePackageIDs("Vendor::Name@1.2", "Vendor::Name@1.2.0") == 0);
+  EXPECT_TRUE(RtePackage::ComparePackageIDs("Vendor::Name@1.10.0", "Vendor::Name@1.9.0") < 0);
 
   EXPECT_EQ(RtePackage::ReleaseVersionFromId(id), "1.2.3");
   EXPECT_EQ(RtePackage::ReleaseIdFromId(id), "Vendor::Name@1.2.3");
@@ -8,6 +8,7 @@
 
 #include "RteModel.h"
 #include "RteKernelSlim.h"
+#include "RtePackCache.h"
 #include "RteCprjProject.h"
 #include "CprjFile.h"
 
@@ -17,9 +18,11 @@
 #include "XMLTreeSlim.h"
 
 #include "RteFsUtils.h"
+#include "WildCards.h"
 
 #include <iostream>
 #include <fstream>
+#include <functional>
 
 using namespace std;
 
@@ -137,6 +140,262 @@ TEST_F(RteModelTestConfig, PackRegistryLoadPacks) {
   EXPECT_TRUE(globalModel->PurgeModel(true));
 }
 
+TEST_F(RteModelTestConfig, PackRegistryLoadPacksParallel) {
+
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(packsDir);
+  EXPECT_EQ(rteKernel.GetPackLoadThreads(), 1);
+  rteKernel.SetPackLoadThreads(0);
+  EXPECT_GE(rteKernel.GetPackLoadThreads(), 1);
+
+  RteKernelSlim rteKernelParallel;
+  rteKernelParallel.SetCmsisPackRoot(packsDir);
+  rteKernelParallel.SetPackLoadThreads(4);
+  EXPECT_EQ(rteKernelParallel.GetPackLoadThreads(), 4);
+
+  list<string> files;
+  rteKernel.GetEffectivePdscFiles(files, false);
+  ASSERT_FALSE(files.empty());
+
+  RteModel testModel(PackageState::PS_INSTALLED);
+  RteModel testModelParallel(PackageState::PS_INSTALLED);
+  rteKernel.SetPackLoadThreads(1);
+  list<RtePackage*> packs, packsParallel;
+  EXPECT_TRUE(rteKernel.LoadPacks(files, packs, &testModel));
+  EXPECT_TRUE(rteKernelParallel.LoadPacks(files, packsParallel, &testModelParallel));
+  ASSERT_EQ(packs.size(), packsParallel.size());
+  // packs are delivered in the same order with the same content
+  for(auto it = packs.begin(), itParallel = packsParallel.begin(); it != packs.end(); it++, itParallel++) {
+    EXPECT_EQ((*it)->GetPackageFileName(), (*itParallel)->GetPackageFileName());
+    EXPECT_EQ((*it)->GetID(), (*itParallel)->GetID());
+    EXPECT_EQ((*it)->GetChildren().size(), (*itParallel)->GetChildren().size());
+    EXPECT_EQ((*itParallel)->GetParent(), &testModelParallel);
+  }
+  // already loaded packs are taken from the registry
+  list<RtePackage*> packsParallel1;
+  EXPECT_TRUE(rteKernelParallel.LoadPacks(files, packsParallel1, &testModelParallel));
+  EXPECT_EQ(packsParallel, packsParallel1);
+
+  // failing file is reported, other packs are loaded
+  list<string> filesWithError = files;
+  filesWithError.push_front(packsDir + "/ARM/RteTest/0.1.0/missing.pdsc");
+  packsParallel1.clear();
+  EXPECT_FALSE(rteKernelParallel.LoadPacks(filesWithError, packsParallel1, &testModelParallel, true));
+  EXPECT_EQ(packsParallel1.size(), files.size());
+
+  // load and insert packs into global model
+  list<RtePackage*> loadedPacks;
+  EXPECT_TRUE(rteKernelParallel.LoadAndInsertPacks(loadedPacks, files));
+  EXPECT_EQ(loadedPacks.size(), files.size());
+  EXPECT_EQ(rteKernelParallel.GetGlobalModel()->GetPackages().size(), files.size());
+  EXPECT_FALSE(rteKernelParallel.LoadAndInsertPacks(loadedPacks, filesWithError));
+}
+
+TEST_F(RteModelTestConfig, PackRegistryLoadPacksCached) {
+
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteFsUtils::AbsolutePath(packsDir).generic_string());
+  EXPECT_TRUE(rteKernel.GetPackCacheDir().empty());
+  EXPECT_TRUE(rteKernel.GetPackIndexFile().empty());
+  rteKernel.SetPackCacheEnabled(true);
+  const string cacheDir = rteKernel.GetPackCacheDir();
+  EXPECT_EQ(cacheDir, rteKernel.GetCmsisPackRoot() + "/.Local/.cache");
+
+  list<string> files;
+  rteKernel.GetEffectivePdscFiles(files, false);
+  ASSERT_FALSE(files.empty());
+
+  // first load parses pdsc files and writes the cache
+  RteModel testModel(PackageState::PS_INSTALLED);
+  list<RtePackage*> packs;
+  EXPECT_TRUE(rteKernel.LoadPacks(files, packs, &testModel));
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(cacheDir), (int)files.size());
+  const string parserInfo = rteKernel.GetPackCacheParserInfo();
+  EXPECT_NE(parserInfo.find(rteKernel.CreateUniqueXmlTree(nullptr, ".pdsc")->GetParseOptions()), string::npos);
+  RtePackCache packCache(cacheDir, parserInfo);
+  for(auto& f : files) {
+    EXPECT_TRUE(RteFsUtils::Exists(packCache.GetCacheFileName(f)));
+  }
+
+  // second load restores the same item trees from the cache
+  std::function<void(RteItem*, RteItem*)> compareItems = [&](RteItem* item, RteItem* cached) {
+    ASSERT_TRUE(cached != nullptr);
+    EXPECT_EQ(item->GetTag(), cached->GetTag());
+    EXPECT_EQ(item->GetText(), cached->GetText());
+    EXPECT_EQ(item->GetLineNumber(), cached->GetLineNumber());
+    EXPECT_EQ(item->GetAttributes(), cached->GetAttributes());
+    EXPECT_EQ(item->GetRootFileName(), cached->GetRootFileName());
+    ASSERT_EQ(item->GetChildren().size(), cached->GetChildren().size());
+    for(auto it = item->GetChildren().begin(), itCached = cached->GetChildren().begin(); it != item->GetChildren().end(); it++, itCached++) {
+      compareItems(*it, *itCached);
+    }
+  };
+  RteKernelSlim rteKernelCached;
+  rteKernelCached.SetCmsisPackRoot(rteKernel.GetCmsisPackRoot());
+  rteKernelCached.SetPackCacheEnabled(true);
+  RteModel testModelCached(PackageState::PS_INSTALLED);
+  list<RtePackage*> packsCached;
+  EXPECT_TRUE(rteKernelCached.LoadPacks(files, packsCached, &testModelCached));
+  ASSERT_EQ(packs.size(), packsCached.size());
+  for(auto it = packs.begin(), itCached = packsCached.begin(); it != packs.end(); it++, itCached++) {
+    compareItems(*it, *itCached);
+    EXPECT_EQ((*it)->GetID(), (*itCached)->GetID());
+    EXPECT_EQ((*itCached)->GetParent(), &testModelCached);
+  }
+
+  // modified pdsc file is parsed again
+  const string& pdscFile = *files.begin();
+  string buf;
+  EXPECT_TRUE(RteFsUtils::ReadFile(pdscFile, buf));
+  RteUtils::ReplaceAll(buf, "</package>", "<dummy_child/></package>");
+  EXPECT_TRUE(RteFsUtils::CopyBufferToFile(pdscFile, buf, false));
+  RteItemBuilder builder(&testModelCached, PackageState::PS_INSTALLED);
+  EXPECT_FALSE(packCache.Load(pdscFile, &builder));
+  packsCached.clear();
+  EXPECT_TRUE(rteKernelCached.LoadPacks({ pdscFile }, packsCached, &testModelCached, true));
+  ASSERT_EQ(packsCached.size(), 1);
+  EXPECT_TRUE((*packsCached.begin())->GetFirstChild("dummy_child") != nullptr);
+  // the cache is updated
+  RteItemBuilder builder1(nullptr, PackageState::PS_INSTALLED);
+  EXPECT_TRUE(packCache.Load(pdscFile, &builder1));
+  ASSERT_TRUE(builder1.GetPack() != nullptr);
+  EXPECT_TRUE(builder1.GetPack()->GetFirstChild("dummy_child") != nullptr);
+  delete builder1.GetPack();
+
+  // cache files written by another tool version or with other parse options are ignored
+  RtePackCache otherPackCache(cacheDir, parserInfo + "other");
+  RteItemBuilder builder3(nullptr, PackageState::PS_INSTALLED);
+  EXPECT_FALSE(otherPackCache.Load(pdscFile, &builder3));
+  EXPECT_TRUE(builder3.GetPack() == nullptr);
+
+  // corrupted cache file is ignored
+  EXPECT_TRUE(RteFsUtils::CopyBufferToFile(packCache.GetCacheFileName(pdscFile), "RTEPACK2garbage", false));
+  RteItemBuilder builder2(nullptr, PackageState::PS_INSTALLED);
+  EXPECT_FALSE(packCache.Load(pdscFile, &builder2));
+  EXPECT_TRUE(builder2.GetPack() == nullptr);
+
+  // pruning removes corrupted files, then the oldest ones until the size limit is met
+  packCache.Prune();
+  EXPECT_FALSE(RteFsUtils::Exists(packCache.GetCacheFileName(pdscFile)));
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(cacheDir), (int)files.size() - 1);
+  packCache.Prune(0);
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(cacheDir), 0);
+}
+
+TEST_F(RteModelTestConfig, ScanPack) {
+
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteFsUtils::AbsolutePath(packsDir).generic_string());
+  const string dfpFile = rteKernel.GetCmsisPackRoot() + "/ARM/RteTest_DFP/0.2.0/ARM.RteTest_DFP.pdsc";
+
+  // header elements only
+  unique_ptr<RtePackage> pack = rteKernel.ScanPack(dfpFile);
+  ASSERT_TRUE(pack);
+  EXPECT_EQ(pack->GetID(), "ARM::RteTest_DFP@0.2.0");
+  ASSERT_TRUE(pack->GetReleases() != nullptr);
+  EXPECT_FALSE(pack->GetReleases()->GetChildren().empty());
+  EXPECT_TRUE(pack->GetComponents() == nullptr);
+  EXPECT_TRUE(pack->GetDeviceFamiles() == nullptr);
+  // scanned packs are not registered
+  EXPECT_TRUE(rteKernel.GetPackRegistry()->GetPack(dfpFile) == nullptr);
+
+  // requested elements
+  pack = rteKernel.ScanPack(dfpFile, { "releases", "components" });
+  ASSERT_TRUE(pack);
+  EXPECT_TRUE(pack->GetComponents() != nullptr);
+  EXPECT_TRUE(pack->GetDeviceFamiles() == nullptr);
+
+  EXPECT_FALSE(rteKernel.ScanPack(rteKernel.GetCmsisPackRoot() + "/ARM/Unknown.pdsc"));
+}
+
+TEST_F(RteModelTestConfig, PackIndex) {
+
+  const string packRoot = RteFsUtils::AbsolutePath(packsDir).generic_string();
+  RteKernelSlim rteKernelNoIndex;
+  rteKernelNoIndex.SetCmsisPackRoot(packRoot);
+  EXPECT_TRUE(rteKernelNoIndex.GetPackIndexFile().empty());
+  EXPECT_TRUE(rteKernelNoIndex.GetPackIndex() == nullptr);
+  map<string, string, RtePackageComparator> pdscMap;
+  rteKernelNoIndex.GetInstalledPdscFiles(pdscMap);
+  ASSERT_FALSE(pdscMap.empty());
+
+  // first call scans pack root and writes the index
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(packRoot);
+  rteKernel.SetPackCacheEnabled(true);
+  const string indexFile = rteKernel.GetPackIndexFile();
+  EXPECT_EQ(indexFile, packRoot + "/.Local/installed_packs.idx");
+  map<string, string, RtePackageComparator> pdscMapIndexed;
+  rteKernel.GetInstalledPdscFiles(pdscMapIndexed);
+  EXPECT_EQ(pdscMapIndexed, pdscMap);
+  EXPECT_TRUE(RteFsUtils::Exists(indexFile));
+
+  RtePackIndex packIndex(packRoot);
+  EXPECT_TRUE(packIndex.Load(indexFile));
+  EXPECT_TRUE(packIndex.IsValid());
+  EXPECT_EQ(packIndex.GetEntries().size(), pdscMap.size());
+  const string dfpFile = packRoot + "/ARM/RteTest_DFP/0.2.0/ARM.RteTest_DFP.pdsc";
+  const RtePackIndex::Entry* entry = packIndex.GetEntry(dfpFile);
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_EQ(entry->id, "ARM::RteTest_DFP@0.2.0");
+  EXPECT_FALSE(entry->bLoaded);
+
+  // loaded packs add their identity
+  list<string> files;
+  rteKernel.GetEffectivePdscFiles(files, true);
+  list<RtePackage*> packs;
+  EXPECT_TRUE(rteKernel.LoadAndInsertPacks(packs, files));
+  EXPECT_TRUE(packIndex.Load(indexFile));
+  entry = packIndex.GetEntry(dfpFile);
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_TRUE(entry->bLoaded);
+  EXPECT_EQ(entry->id, "ARM::RteTest_DFP@0.2.0");
+  EXPECT_TRUE(RtePackIndex::IsCurrent(*entry));
+
+  // latest versions are taken from the index without loading packs
+  map<string, pair<string, string>> latestPacks, latestPacksIndexed;
+  EXPECT_TRUE(rteKernelNoIndex.ReadPackLatestVerAndPath(latestPacks));
+  RteKernelSlim rteKernelIndexed;
+  rteKernelIndexed.SetCmsisPackRoot(packRoot);
+  rteKernelIndexed.SetPackCacheEnabled(true);
+  EXPECT_TRUE(rteKernelIndexed.ReadPackLatestVerAndPath(latestPacksIndexed));
+  EXPECT_EQ(latestPacksIndexed, latestPacks);
+  EXPECT_TRUE(rteKernelIndexed.GetPackRegistry()->GetPack(dfpFile) == nullptr);
+
+  // removed pack version invalidates the index
+  const string removedFile = packRoot + "/ARM/RteTestBoard/0.0.1/ARM.RteTestBoard.pdsc";
+  ASSERT_TRUE(packIndex.GetEntry(removedFile) != nullptr);
+  RteFsUtils::DeleteTree(packRoot + "/ARM/RteTestBoard/0.0.1");
+  EXPECT_FALSE(packIndex.IsValid());
+  RteKernelSlim rteKernelRescan;
+  rteKernelRescan.SetCmsisPackRoot(packRoot);
+  rteKernelRescan.SetPackCacheEnabled(true);
+  ASSERT_TRUE(rteKernelRescan.GetPackIndex() != nullptr);
+  EXPECT_TRUE(rteKernelRescan.GetPackIndex()->GetEntry(removedFile) == nullptr);
+  EXPECT_EQ(rteKernelRescan.GetPackIndex()->GetEntries().size(), pdscMap.size() - 1);
+  // information of loaded packs is preserved
+  entry = rteKernelRescan.GetPackIndex()->GetEntry(dfpFile);
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_TRUE(entry->bLoaded);
+  EXPECT_TRUE(packIndex.Load(indexFile));
+  EXPECT_TRUE(packIndex.IsValid());
+
+  // information of a modified pdsc is dropped on the next scan
+  fs::last_write_time(dfpFile, fs::last_write_time(dfpFile) + chrono::seconds(10));
+  entry = packIndex.GetEntry(dfpFile);
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_FALSE(RtePackIndex::IsCurrent(*entry));
+  packIndex.Scan();
+  entry = packIndex.GetEntry(dfpFile);
+  ASSERT_TRUE(entry != nullptr);
+  EXPECT_FALSE(entry->bLoaded);
+
+  // corrupted index file is ignored
+  EXPECT_TRUE(RteFsUtils::CopyBufferToFile(indexFile, "RTEPACKIDX2\t" + packRoot + "\ngarbage\n", false));
+  EXPECT_FALSE(packIndex.Load(indexFile));
+  EXPECT_TRUE(packIndex.GetEntries().empty());
+}
+
 TEST(RteModelTest, LoadPacks) {
 
   RteKernelSlim rteKernel;  // here just to instantiate XMLTree parser
@@ -313,6 +572,91 @@ TEST(RteModelTest, LoadPacks) {
   EXPECT_EQ(api->GetPackageID(), "ARM::RteTest_DFP@0.1.1");
 }
 
+TEST(RteModelTest, ClearModelStringPool) {
+  RteGlobalModel model;
+  RteItem item(nullptr);
+  item.AddAttribute("name", "value");
+  // items created after clearing the model do not add strings to the previous pool
+  model.ClearModel();
+  RteItem newItem(nullptr);
+  newItem.AddAttribute("name", "value");
+  EXPECT_FALSE(newItem.GetAttributes().HasSamePool(item.GetAttributes()));
+  EXPECT_TRUE(newItem.EqualAttributes(item));
+  // previous pool remains valid for existing items
+  EXPECT_EQ(item.GetAttribute("name"), "value");
+}
+
+TEST(RteModelTest, DeviceAndBoardIndex) {
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  list<string> files;
+  rteKernel.GetEffectivePdscFiles(files, false);
+  RteModel* rteModel = rteKernel.GetGlobalModel();
+  ASSERT_NE(rteModel, nullptr);
+  rteModel->SetUseDeviceTree(true);
+  list<RtePackage*> packs;
+  EXPECT_TRUE(rteKernel.LoadPacks(files, packs));
+  rteModel->InsertPacks(packs);
+  RteDeviceItemAggregate* deviceTree = rteModel->GetDeviceTree();
+
+  // indexed lookups must give the same results as searches in the device tree and board map
+  const list<string> vendors = { "", "ARM", "ARM:82", "Unknown" };
+  const list<string> patterns = { "", "*", "RteTest*", "RteTest_ARMCM?", "RteTest_ARMCM[34]", "*Dual", "*_ARMCM0*", "Unknown*" };
+  for(auto& vendor : vendors) {
+    for(auto& pattern : patterns) {
+      for(auto depth : { RteDeviceItem::DEVICE, RteDeviceItem::VARIANT, RteDeviceItem::PROCESSOR }) {
+        list<RteDevice*> expected, devices;
+        deviceTree->GetDevices(expected, pattern, vendor, depth);
+        rteModel->GetDevices(devices, pattern, vendor, depth);
+        EXPECT_EQ(devices, expected) << "pattern '" << pattern << "', vendor '" << vendor << "'";
+      }
+    }
+  }
+  list<RteDevice*> allDevices;
+  deviceTree->GetDevices(allDevices, "", "", RteDeviceItem::PROCESSOR);
+  EXPECT_FALSE(allDevices.empty());
+  for(auto d : allDevices) {
+    for(auto& vendor : vendors) {
+      const string& name = d->GetName();
+      EXPECT_EQ(rteModel->GetDeviceAggregate(name, vendor), deviceTree->GetDeviceAggregate(name, vendor));
+      RteDevice* expected = nullptr;
+      for(auto [_, dv] : rteModel->GetDeviceVendors()) {
+        if(vendor.empty() && (expected = dv->GetDevice(name)) != nullptr) {
+          break;
+        }
+      }
+      if(!expected && !vendor.empty()) {
+        RteDeviceVendor* dv = rteModel->FindDeviceVendor(DeviceVendor::GetCanonicalVendorName(vendor));
+        expected = dv ? dv->GetDevice(name) : nullptr;
+      }
+      if(!expected) {
+        expected = dynamic_cast<RteDevice*>(deviceTree->GetDeviceItem(name, vendor));
+      }
+      EXPECT_EQ(rteModel->GetDevice(name, vendor), expected) << name << " " << vendor;
+    }
+  }
+  EXPECT_TRUE(rteModel->GetDevice("Unknown", "") == nullptr);
+
+  ASSERT_FALSE(rteModel->GetBoards().empty());
+  for(auto [id, b] : rteModel->GetBoards()) {
+    EXPECT_EQ(rteModel->FindBoard(b->GetDisplayName()), b);
+    list<RteBoard*> boards;
+    rteModel->GetBoards(boards, id, b->GetVendorString());
+    EXPECT_EQ(boards.size(), 1);
+  }
+  EXPECT_TRUE(rteModel->FindBoard("Unknown") == nullptr);
+  list<RteBoard*> boards;
+  rteModel->GetBoards(boards, "RteTest*", "");
+  list<RteBoard*> expectedBoards;
+  for(auto [id, b] : rteModel->GetBoards()) {
+    if(WildCards::MatchToPattern(id, "RteTest*")) {
+      expectedBoards.push_back(b);
+    }
+  }
+  EXPECT_FALSE(boards.empty());
+  EXPECT_EQ(boards, expectedBoards);
+}
+
 class RteModelPrjTest : public RteModelTestConfig
 {
 protected:
@@ -904,6 +1248,50 @@ TEST_F(RteModelPrjTest, LoadCprjCompDep) {
   EXPECT_EQ(res, RteItem::SELECTABLE);
 }
 
+TEST_F(RteModelPrjTest, ComponentIndex) {
+
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+  RteCprjProject* loadedCprjProject = rteKernel.LoadCprj(RteTestM4_CompDep_cprj);
+  ASSERT_NE(loadedCprjProject, nullptr);
+  RteTarget* activeTarget = loadedCprjProject->GetActiveTarget();
+  ASSERT_NE(activeTarget, nullptr);
+  const RteComponentMap& filteredComponents = activeTarget->GetFilteredComponents();
+  ASSERT_FALSE(filteredComponents.empty());
+
+  // indexed lookups must give the same results as a linear scan
+  list<XmlAttributes> queries = {
+    {},
+    {{"Cclass", "RteTest"}},
+    {{"Cclass", "RteTest*"}},
+    {{"Cclass", "Unknown"}},
+    {{"Cclass", "RteTest"}, {"Cgroup", "*"}},
+    {{"Cvendor", "*"}, {"Cclass", "*"}, {"Cgroup", "*"}, {"Csub", "*"}, {"Cvariant", "*"}}
+  };
+  for (auto [_, c] : filteredComponents) {
+    XmlAttributes full;
+    for (auto a : { "Cvendor", "Cclass", "Cgroup", "Csub", "Cvariant" }) {
+      full.set(a, c->GetAttribute(a));
+    }
+    queries.push_back(full);
+    XmlAttributes partial = full;
+    partial.erase("Csub");
+    partial.set("Cversion", c->GetVersionString());
+    queries.push_back(partial);
+  }
+  for (auto& attributes : queries) {
+    set<RteComponent*> expected, components;
+    for (auto [_, c] : filteredComponents) {
+      if (c->MatchComponentAttributes(attributes)) {
+        expected.insert(c);
+      }
+    }
+    RteItem::ConditionResult res = activeTarget->GetComponents(attributes, components);
+    EXPECT_EQ(components, expected);
+    EXPECT_EQ(res == RteItem::MISSING, expected.empty());
+  }
+}
+
 
 #define CFLAGS "-xc -std=c99 --target=arm-arm-none-eabi -mcpu=cortex-m3"
 #define CXXFLAGS "-cxx"
@@ -8,12 +8,14 @@
 #define COLLECTION_UTILS_H
 
 #include <algorithm>
+#include <functional>
 #include <list>
 #include <map>
 #include <vector>
 #include <set>
 #include <string>
 #include <optional>
+#include <unordered_set>
 
 /**
  * @brief Returns value stored in a map for a given key or default value if no entry is found
@@ -207,6 +209,81 @@ struct StringVectorCollection {
 };
 
 
+/**
+ * @brief vector of unique elements kept in insertion order,
+ *        a hash index replaces the linear search of PushBackUniquely
+ * @tparam T element type
+ * @tparam Hash hash function for T
+*/
+template<typename T, typename Hash = std::hash<T>>
+class UniqueVector {
+public:
+  UniqueVector() {}
+
+  /**
+   * @brief construct from a collection, duplicates are dropped keeping the first occurrence
+   * @param items collection of elements
+  */
+  template<typename C>
+  explicit UniqueVector(const C& items) {
+    AddItems(items);
+  }
+
+  /**
+   * @brief add a value if it is not already contained
+   * @param value the value to add
+   * @return true if the value was added
+  */
+  bool PushBack(const T& value) {
+    if (!m_index.insert(value).second) {
+      return false;
+    }
+    m_items.push_back(value);
+    return true;
+  }
+
+  /**
+   * @brief add all values of a collection that are not already contained
+   * @param items collection of elements
+  */
+  template<typename C>
+  void AddItems(const C& items) {
+    for (const auto& value : items) {
+      PushBack(value);
+    }
+  }
+
+  /**
+   * @brief check if a value is contained
+   * @param value the value to search for
+   * @return true if found
+  */
+  bool Contains(const T& value) const {
+    return m_index.find(value) != m_index.end();
+  }
+
+  /**
+   * @brief get contained elements
+   * @return vector of elements in insertion order
+  */
+  const std::vector<T>& GetItems() const {
+    return m_items;
+  }
+
+  size_t Size() const { return m_items.size(); }
+  bool Empty() const { return m_items.empty(); }
+  void Clear() {
+    m_items.clear();
+    m_index.clear();
+  }
+
+  typename std::vector<T>::const_iterator begin() const { return m_items.begin(); }
+  typename std::vector<T>::const_iterator end() const { return m_items.end(); }
+
+private:
+  std::vector<T> m_items;
+  std::unordered_set<T, Hash> m_index;
+};
 
 class CollectionUtils
 {
@@ -15,6 +15,7 @@
 /******************************************************************************/
 
 #include <string>
+#include <string_view>
 #include <set>
 
 class VersionCmp
@@ -125,6 +126,42 @@ public:
   static const std::string GetMatchingVersion(const std::string& filter,
     const std::set<std::string>& availableVersions, bool bCompatible = false);
 
+  /**
+   * @brief pre-parsed version for repeated comparisons.
+   *        Plain numeric MAJOR.MINOR.PATCH segments are stored as numbers, the key keeps a copy of the source string.
+   *        Versions with non-numeric segments are compared with the same rules as by VersionCmp::Compare().
+  */
+  class Key
+  {
+  public:
+    /**
+     * @brief constructor
+     * @param version version string to parse
+    */
+    Key(std::string_view version = std::string_view());
+
+    /**
+     * @brief compare with another key, equivalent to VersionCmp::Compare()
+     * @param that key to compare with
+     * @param cs true in case of case sensitive comparison
+     * @return 0 if both versions are equal, > 0 if this is greater, < 0 if that is greater
+    */
+    int Compare(const Key& that, bool cs = true) const;
+
+    /**
+     * @brief get source version string
+     * @return version string the key was created from
+    */
+    std::string_view GetVersion() const { return m_version; }
+
+  private:
+    std::string m_version; // source string
+    std::string m_release; // pre-release tail without build metadata
+    unsigned m_segments[3]; // MAJOR.MINOR.PATCH
+    bool m_bRelease; // pre-release tail exists, can be empty
+    bool m_bNumeric; // all segments are plain decimal numbers
+  };
+
   class ComparatorBase
   {
   public:
@@ -70,6 +70,15 @@ public:
    * @return true if match is successful
   */
   static bool MatchToPattern(const std::string& s, const std::string& pattern);
+
+  /**
+   * @brief matches supplied string against a wild card pattern converted to std::regex with ToRegEx()
+   *        reference implementation, used by MatchToPattern() for patterns with regular expression syntax
+   * @param s string to be matched, wild cards are considered as normal characters
+   * @param pattern wild card expression to match against
+   * @return true if match is successful
+  */
+  static bool MatchToRegEx(const std::string& s, const std::string& pattern);
 };
 
 #endif // WildCards_H
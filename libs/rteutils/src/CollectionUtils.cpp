@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -32,8 +32,15 @@ void CollectionUtils::PushBackUniquely(StrPairVec& vec, const StrPair& value) {
 }
 
 void CollectionUtils::AddStringItemsUniquely(vector<string>& dst, const vector<string>& src) {
+  if (src.empty()) {
+    return;
+  }
+  // duplicates already contained in destination are kept
+  unordered_set<string> index(dst.begin(), dst.end());
   for (const auto& value : src) {
-    PushBackUniquely(dst,value);
+    if (index.insert(value).second) {
+      dst.push_back(value);
+    }
   }
 }
 
@@ -16,6 +16,8 @@
 
 #include "RteUtils.h"
 
+#include <mutex>
+
 using namespace std;
 
 // static data members
@@ -48,12 +50,13 @@ bool DeviceVendor::Match(const string& vendor1, const string& vendor2)
 
 const map<string, string>& DeviceVendor::GetVendorIdToIdMap()
 {
-  if (m_vendorIdToId.empty()) {
+  static once_flag vendorIdToIdFilled;
+  call_once(vendorIdToIdFilled, []() {
     m_vendorIdToId["97"] = "21"; // EnergyMicro -> Silicon Labs
     m_vendorIdToId["100"] = "19"; // Spansion -> Cypress
     m_vendorIdToId["114"] = "19"; // Fujitsu -> Cypress
     m_vendorIdToId["78"] = "11"; // Freescale -> NXP
-  }
+  });
   return m_vendorIdToId;
 }
 
@@ -69,7 +72,8 @@ const string& DeviceVendor::VendorIDToOfficialID(const string& vendorSuffix)
 
 const map<string, string>& DeviceVendor::GetVendorNameToIdMap()
 {
-  if (m_vendorNameToId.empty()) {
+  static once_flag vendorNameToIdFilled;
+  call_once(vendorNameToIdFilled, []() {
     m_vendorNameToId["NO_VENDOR"] = "0";
     m_vendorNameToId["3PEAK"] = "177";
     m_vendorNameToId["ABOV Semiconductor"] = "126";
@@ -210,7 +214,7 @@ const map<string, string>& DeviceVendor::GetVendorNameToIdMap()
     m_vendorNameToId["Zylogic Semiconductor Corp."] = "69";
     m_vendorNameToId["Renesas"] = "117";
     m_vendorNameToId["AutoChips"] = "150";
-  }
+  });
   return m_vendorNameToId;
 }
 
@@ -226,7 +230,8 @@ const string& DeviceVendor::VendorNameToID(const string& vendorPrefix)
 
 const map<string, string>& DeviceVendor::GetVendorIdToNameMap()
 {
-  if (m_vendorIdToName.empty()) {
+  static once_flag vendorIdToNameFilled;
+  call_once(vendorIdToNameFilled, []() {
     m_vendorIdToName["0"] = "NO_VENDOR";
     m_vendorIdToName["177"] = "3PEAK";
     m_vendorIdToName["126"] = "ABOV Semiconductor";
@@ -354,7 +359,7 @@ const map<string, string>& DeviceVendor::GetVendorIdToNameMap()
     m_vendorIdToName["69"] = "Zylogic Semiconductor Corp.";
     m_vendorIdToName["117"] = "Renesas";
     m_vendorIdToName["150"] = "AutoChips";
-  }
+  });
   return m_vendorIdToName;
 }
 
@@ -614,7 +614,7 @@ bool RteUtils::GetAccessSequence(size_t& offset, const string& src, string& sequ
 }
 
 void RteUtils::ApplyFilter(const vector<string>& origin, const set<string>& filter, vector<string>& result) {
-  result.clear();
+  UniqueVector<string> matches;
   for (const auto& item : origin) {
     bool match = true;
     for (const auto& word : filter) {
@@ -627,9 +627,10 @@ void RteUtils::ApplyFilter(const vector<string>& origin, const set<string>& filt
       }
     }
     if (match) {
-      CollectionUtils::PushBackUniquely(result, item);
+      matches.PushBack(item);
     }
   }
+  result = matches.GetItems();
 }
 
 string RteUtils::RemoveLeadingSpaces(const string& input) {
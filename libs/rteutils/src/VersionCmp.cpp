@@ -36,19 +36,19 @@ private:
   char* release; // remainder (after '-');
 
 public:
-  Version(const string& ver) : m_ptr(0), release(0) {
+  Version(string_view ver) : m_ptr(0), release(0) {
     init(ver);
   }
 
 private:
 
-  void init(const string& version) {
+  void init(string_view version) {
     // leave one char room for extra 0
     size_t len = version.length();
     if (len >= MAX_BUF - 1) {
       len = MAX_BUF - 2;
     }
-    memcpy(buf, version.c_str(), len);
+    memcpy(buf, version.data(), len);
     buf[len] = '\0';
     m_ptr = buf;
     // 1. drop build metadata
@@ -151,15 +151,87 @@ public:
 };
 
 
+VersionCmp::Key::Key(string_view version) :
+  m_version(version),
+  m_segments{ 0, 0, 0 },
+  m_bRelease(false),
+  m_bNumeric(version.length() < MAX_BUF - 1) // longer strings are truncated by Version
+{
+  // same steps as Version::init() and Version::parse()
+  // 1. drop build metadata
+  string_view core = string_view(m_version).substr(0, m_version.find('+'));
+  // 2. extract release
+  auto dash = core.find('-');
+  if (dash != string_view::npos) {
+    m_release = core.substr(dash + 1);
+    m_bRelease = true;
+    core = core.substr(0, dash);
+  } else {
+    // special ST case without dash like 1.2.3b < 1.2.3
+    for (size_t pos = core.length(); pos > 0; pos--) {
+      char ch = core[pos - 1];
+      if (ch == '.')
+        break;
+      if (!isdigit((unsigned char)ch))
+        continue;
+      if (pos < core.length()) {
+        m_release = core.substr(pos);
+        m_bRelease = true;
+        core = core.substr(0, pos);
+      }
+      break;
+    }
+  }
+  // 3. split segments
+  size_t p = 0;
+  for (int i = 0; i < 3 && p < core.length(); i++) {
+    auto dot = core.find('.', p);
+    string_view segment = core.substr(p, dot == string_view::npos ? string_view::npos : dot - p);
+    p = dot == string_view::npos ? core.length() : dot + 1;
+    if (segment.empty() || segment.length() > 9) {
+      m_bNumeric = false; // empty segment is not equal to "0", long ones could overflow
+      break;
+    }
+    for (char ch : segment) {
+      if (!isdigit((unsigned char)ch)) {
+        m_bNumeric = false;
+        break;
+      }
+      m_segments[i] = m_segments[i] * 10 + (ch - '0');
+    }
+  }
+}
+
+int VersionCmp::Key::Compare(const Key& that, bool cs) const
+{
+  if (m_version == that.m_version) {
+    return 0;
+  }
+  if (!m_bNumeric || !that.m_bNumeric) {
+    return Version(m_version).compareTo(Version(that.m_version), cs);
+  }
+  for (int i = 0; i < 3; i++) {
+    if (m_segments[i] != that.m_segments[i]) {
+      return m_segments[i] > that.m_segments[i] ? 3 - i : i - 3;
+    }
+  }
+  if (!m_bRelease && !that.m_bRelease)
+    return 0;
+  else if (!m_bRelease)
+    return 1;
+  else if (!that.m_bRelease)
+    return -1;
+  // the release is case - insensitive
+  int result = Version(m_release).compareTo(Version(that.m_release), false);
+  return result < 0 ? -1 : (result > 0 ? 1 : 0);
+}
+
 int VersionCmp::Compare(const string& v1, const string& v2, bool cs) {
   if (v1 == v2) {
     return 0;
   }
   // Split v1 and v2 according to http://semver.org/ and compare individually
-  Version ver1(v1);
-  Version ver2(v2);
-  int res = ver1.compareTo(ver2, cs);
-  return res;
+  return Key(v1).Compare(Key(v2), cs);
 }
 
 int VersionCmp::RangeCompare(const string& version, const string& versionRange, bool bCompatible)
@@ -170,14 +242,15 @@ int VersionCmp::RangeCompare(const string& version, const string& versionRange,
 
   string verMin = RteUtils::GetPrefix(versionRange);
   string verMax = RteUtils::GetSuffix(versionRange);
+  Key versionKey(version);
   int resMin = 0;
   if (!verMin.empty()) {
-    resMin = Compare(version, verMin);
+    resMin = versionKey.Compare(Key(verMin));
     if (resMin < 0 || verMin == verMax) // lower than min or exact match is required?
       return resMin;
   }
   if (!verMax.empty()) {
-    int resMax = Compare(version, verMax);
+    int resMax = versionKey.Compare(Key(verMax));
     if (resMax > 0)
       return resMax;
   }else if(bCompatible && resMin > 2) {
@@ -317,8 +390,10 @@ const std::string VersionCmp::GetMatchingVersion(const std::string& filter,
     if (mode == MatchMode::HIGHER_OR_EQUAL) {
       filterVersion = RteUtils::StripPrefix(filterVersion, HIGHER_OR_EQUAL_OPERATOR);
     }
+    Key filterKey(filterVersion);
     for (auto& version : availableVersions) {
-      int result = VersionCmp::Compare(version, filterVersion, false);
+      Key versionKey(version);
+      int result = versionKey.Compare(filterKey, false);
       switch (mode) {
       case MatchMode::FIXED_VERSION:
         if (result == 0)
@@ -328,7 +403,7 @@ const std::string VersionCmp::GetMatchingVersion(const std::string& filter,
       case MatchMode::HIGHER_OR_EQUAL:
         if (result > 0 || result == 0) {
           matchedVersion = version;
-          filterVersion = matchedVersion;
+          filterKey = versionKey;
         }
         break;
       default: // never happening
@@ -13,7 +13,207 @@
 /******************************************************************************/
 
 #include "WildCards.h"
+
+#include <bitset>
 #include <regex>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief wild card pattern compiled into a sequence of tokens.
+ *        Matches exactly like the std::regex created by WildCards::ToRegEx():
+ *        '?' and '*' do not match line terminators, brackets support character ranges and '^' negation.
+ *        Patterns using other regular expression syntax are not compiled and must be matched with std::regex.
+*/
+class CompiledPattern
+{
+public:
+  CompiledPattern(const std::string& pattern) { m_compiled = Compile(pattern); }
+
+  bool IsCompiled() const { return m_compiled; }
+
+  bool Match(const std::string& s) const
+  {
+    const size_t n = m_tokens.size();
+    std::vector<char> cur(n + 1, 0);
+    std::vector<char> next(n + 1, 0);
+    cur[0] = 1;
+    Closure(cur);
+    for (char ch : s) {
+      const unsigned char c = static_cast<unsigned char>(ch);
+      const bool lineTerminator = ch == '\n' || ch == '\r';
+      bool any = false;
+      std::fill(next.begin(), next.end(), 0);
+      for (size_t i = 0; i < n; i++) {
+        if (!cur[i]) {
+          continue;
+        }
+        const Token& t = m_tokens[i];
+        bool advance = false;
+        switch (t.op) {
+        case CHAR:
+          advance = t.ch == ch;
+          break;
+        case ANY:
+          advance = !lineTerminator;
+          break;
+        case SET:
+          advance = m_sets[t.set].test(c);
+          break;
+        case STAR:
+          if (!lineTerminator) {
+            next[i] = 1;
+            any = true;
+          }
+          break;
+        }
+        if (advance) {
+          next[i + 1] = 1;
+          any = true;
+        }
+      }
+      if (!any) {
+        return false;
+      }
+      Closure(next);
+      cur.swap(next);
+    }
+    return cur[n] != 0;
+  }
+
+private:
+  enum Op : unsigned char { CHAR, ANY, STAR, SET };
+  struct Token {
+    Op op;
+    char ch;
+    size_t set;
+  };
+
+  void Closure(std::vector<char>& states) const
+  {
+    // '*' can match empty sequence
+    for (size_t i = 0; i < m_tokens.size(); i++) {
+      if (states[i] && m_tokens[i].op == STAR) {
+        states[i + 1] = 1;
+      }
+    }
+  }
+
+  static bool IsSetChar(char ch)
+  {
+    return (ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_';
+  }
+
+  bool CompileSet(const std::string& pattern, size_t& pos)
+  {
+    const size_t len = pattern.length();
+    size_t i = pos + 1;
+    bool negate = false;
+    if (i < len && pattern[i] == '^') {
+      negate = true;
+      i++;
+    }
+    const size_t start = i;
+    if (i >= len || pattern[i] == ']') {
+      return false;
+    }
+    std::bitset<256> set;
+    while (i < len && pattern[i] != ']') {
+      const char lo = pattern[i];
+      if (lo == '-') {
+        if (i != start && (i + 1 >= len || pattern[i + 1] != ']')) {
+          return false;
+        }
+        set.set(static_cast<unsigned char>(lo));
+        i++;
+        continue;
+      }
+      if (!IsSetChar(lo)) {
+        return false;
+      }
+      if (i + 2 < len && pattern[i + 1] == '-' && pattern[i + 2] != ']') {
+        const char hi = pattern[i + 2];
+        if (!IsSetChar(hi) || lo > hi) {
+          return false;
+        }
+        for (int c = lo; c <= hi; c++) {
+          set.set(static_cast<unsigned char>(c));
+        }
+        i += 3;
+        if (i + 1 < len && pattern[i] == '-' && pattern[i + 1] != ']') {
+          return false;
+        }
+        continue;
+      }
+      set.set(static_cast<unsigned char>(lo));
+      i++;
+    }
+    if (i >= len) {
+      return false;
+    }
+    if (negate) {
+      set.flip();
+    }
+    m_tokens.push_back({ SET, 0, m_sets.size() });
+    m_sets.push_back(set);
+    pos = i;
+    return true;
+  }
+
+  bool Compile(const std::string& pattern)
+  {
+    for (size_t pos = 0; pos < pattern.length(); pos++) {
+      const char ch = pattern[pos];
+      switch (ch) {
+      case '*':
+        if (m_tokens.empty() || m_tokens.back().op != STAR) {
+          m_tokens.push_back({ STAR, 0, 0 });
+        }
+        break;
+      case '?':
+        m_tokens.push_back({ ANY, 0, 0 });
+        break;
+      case '[':
+        if (!CompileSet(pattern, pos)) {
+          return false;
+        }
+        break;
+      case ']':
+      case '^':
+      case '|':
+      case '\\':
+        return false; // regular expression syntax
+      default:
+        m_tokens.push_back({ CHAR, ch, 0 });
+        break;
+      }
+    }
+    return true;
+  }
+
+  bool m_compiled;
+  std::vector<Token> m_tokens;
+  std::vector<std::bitset<256> > m_sets;
+};
+
+const CompiledPattern& GetCompiledPattern(const std::string& pattern)
+{
+  // per-thread cache avoids locking when packs are processed concurrently
+  static constexpr size_t MAX_CACHED_PATTERNS = 1024;
+  thread_local std::unordered_map<std::string, CompiledPattern> cache;
+  auto it = cache.find(pattern);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  if (cache.size() >= MAX_CACHED_PATTERNS) {
+    cache.clear();
+  }
+  return cache.emplace(pattern, CompiledPattern(pattern)).first->second;
+}
+
+} // namespace
 
 
 bool WildCards::Match(const std::string& s1, const std::string& s2)
@@ -79,6 +279,15 @@ bool WildCards::IsWildcardPattern(const std::string& s)
 
 
 bool WildCards::MatchToPattern(const std::string& s, const std::string& pattern)
+{
+  const CompiledPattern& compiled = GetCompiledPattern(pattern);
+  if (compiled.IsCompiled()) {
+    return compiled.Match(s);
+  }
+  return MatchToRegEx(s, pattern);
+}
+
+bool WildCards::MatchToRegEx(const std::string& s, const std::string& pattern)
 {
   try {
     std::regex e(ToRegEx(pattern));
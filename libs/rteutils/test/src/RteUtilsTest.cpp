@@ -286,6 +286,23 @@ TEST(RteUtilsTest, WildCardMatch) {
   }
 }
 
+TEST(RteUtilsTest, WildCardMatchToRegEx) {
+  // names and patterns used in test packs plus corner cases of regular expression syntax
+  std::vector<string> names{ "ARMCM0", "ARMCM0P", "Cortex-M0+", "Cortex-M33", "RteTest_ARMCM0_Dual", "RteTest_ARMCM4_NOFP",
+    "RteTest Test board", "RteTest Dummy board", "S6E1A11B0A", "S6E1A12C0A", "STM32F100C4", "STM32F103ZE", "TestM301",
+    "TestDeviceNOk2", "cm0_core1", "a-b", "a^b", "a.b", "a$b", "a|b", "a\\b", "a]b", "a[b", "a\nb", "a\rb", "" };
+  std::vector<string> patterns{ "*ARMCM*", "*ARMCM0", "ARMCM0*", "ARMCM?", "Cortex-M0+", "Cortex-M*+", "RteTest*Test*board*",
+    "S6E1A1[12][BC]0A", "S6E1A1[^2]*", "STM32F10[0-3]??", "STM32F10[123]?[CDE]", "STM32F10[a-z0-9_-]*", "TestM30?",
+    "cm0_core[0-2]", "a[-]b", "a[b-]*", "a[]b", "a[^]b", "a[z-a]b", "a^b", "a?b", "a*b", "a.b", "a$b", "a|b", "a\\b",
+    "a]b", "a[b", "[a-c-e]-b", "(a)*", "**", "" };
+  for (auto& pattern : patterns) {
+    for (auto& name : names) {
+      EXPECT_EQ(WildCards::MatchToPattern(name, pattern), WildCards::MatchToRegEx(name, pattern))
+        << "Failed for '" << name << "' & '" << pattern << "'";
+    }
+  }
+}
+
 TEST(RteUtilsTest, AlnumCmp_Char) {
   EXPECT_EQ( -1, AlnumCmp::Compare(nullptr, "2.1"));
   EXPECT_EQ(  1, AlnumCmp::Compare("10.1", nullptr));
@@ -508,6 +525,27 @@ TEST(RteUtils, CollectionUtils)
 
 }
 
+TEST(RteUtils, UniqueVector)
+{
+  UniqueVector<string> items(vector<string>{ "b", "a", "b", "c" });
+  EXPECT_EQ(items.GetItems(), vector<string>({ "b", "a", "c" }));
+  EXPECT_FALSE(items.PushBack("a"));
+  EXPECT_TRUE(items.PushBack("d"));
+  items.AddItems(list<string>{ "c", "e", "d" });
+  EXPECT_EQ(items.GetItems(), vector<string>({ "b", "a", "c", "d", "e" }));
+  EXPECT_TRUE(items.Contains("e"));
+  EXPECT_FALSE(items.Contains("f"));
+  EXPECT_EQ(items.Size(), 5);
+  items.Clear();
+  EXPECT_TRUE(items.Empty());
+  EXPECT_TRUE(items.PushBack("a"));
+
+  // existing duplicates in destination are kept
+  vector<string> dst = { "x", "y", "x" };
+  CollectionUtils::AddStringItemsUniquely(dst, { "z", "y", "z", "w" });
+  EXPECT_EQ(dst, vector<string>({ "x", "y", "x", "z", "w" }));
+}
+
 TEST(RteUtils, ExpandAccessSequences) {
   StrMap variables = {
     {"Foo", "./foo"},
@@ -81,6 +81,32 @@ TEST(VersionCmpTest, VersionCompare) {
   EXPECT_EQ( -3, VersionCmp::Compare("1.2.3", "v1.2.3"));
 }
 
+TEST(VersionCmpTest, VersionKeyCompare) {
+  const std::string versions[] = { "", "1", "1.0", "1.0.", "1.0.0", "01.0.0", "1.2.3", "1.2.3-rc1", "1.2.3-RC1", "1.2.3-rc.10",
+    "1.2.3-", "1.2.3+meta", "1.2.3b", "1.2b", "1..3", "1.2.3.4", "1.2.3.5", "10.0.0", "1234567890.0.0", "v1.2.3", "Test" };
+  for (auto& v1 : versions) {
+    VersionCmp::Key k1(v1);
+    EXPECT_EQ(k1.GetVersion(), v1);
+    for (auto& v2 : versions) {
+      VersionCmp::Key k2(v2);
+      EXPECT_EQ(k1.Compare(k2), VersionCmp::Compare(v1, v2)) << v1 << " " << v2;
+      EXPECT_EQ(k1.Compare(k2, false), VersionCmp::Compare(v1, v2, false)) << v1 << " " << v2;
+    }
+  }
+  EXPECT_EQ( 0, VersionCmp::Key("1.2.3.4").Compare(VersionCmp::Key("1.2.3.5")));
+  EXPECT_EQ(-1, VersionCmp::Key("1.2.3b").Compare(VersionCmp::Key("1.2.3")));
+  EXPECT_EQ(-2, VersionCmp::Key("1..3").Compare(VersionCmp::Key("1.0.3")));
+  EXPECT_EQ(-1, VersionCmp::Key("1.2.3-rc.9").Compare(VersionCmp::Key("1.2.3-RC.10")));
+  EXPECT_EQ( 3, VersionCmp::Key("1234567890.0.0").Compare(VersionCmp::Key("10.0.0")));
+
+  // the key stays valid after its source string is changed
+  std::string source = "1.2.3-rc.10-with-a-long-release-tail";
+  VersionCmp::Key key(source);
+  source.assign(source.size(), 'x');
+  EXPECT_EQ(key.GetVersion(), "1.2.3-rc.10-with-a-long-release-tail");
+  EXPECT_EQ(VersionCmp::Compare("1.2.3-rc.10-with-a-long-release-tail", "1.2.3-rc.9"), key.Compare(VersionCmp::Key("1.2.3-rc.9")));
+}
+
 TEST(VersionCmpTest, VersionRangeCompare) {
   EXPECT_EQ(0, VersionCmp::RangeCompare("3.2.0", "3.1.0:3.8.0"));
   EXPECT_EQ(0, VersionCmp::RangeCompare("3.2.0", "3.1.0"));
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025-2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef XML_InputSourceReaderMappedFile_H
+#define XML_InputSourceReaderMappedFile_H
+
+#include "XML_InputSourceReaderFile.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+#define XML_READER_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief input source reader that maps the input file into memory and lets XML_Reader
+ *        tokenize directly over the mapped bytes.
+ *        Inline strings and platforms without mmap use the buffered XML_InputSourceReaderFile.
+*/
+class XML_InputSourceReaderMappedFile : public XML_InputSourceReaderFile
+{
+public:
+  XML_InputSourceReaderMappedFile() : XML_InputSourceReaderFile(), m_mappedData(nullptr) {
+  }
+
+  ~XML_InputSourceReaderMappedFile() override {
+    XML_InputSourceReaderMappedFile::Close();
+  }
+
+  bool IsValid() const override {
+    return m_mappedData ? true : XML_InputSourceReaderFile::IsValid();
+  }
+
+  bool IsMapped() const {
+    return m_mappedData != nullptr;
+  }
+
+  void Close() override {
+    Unmap();
+    XML_InputSourceReaderFile::Close();
+  }
+
+  bool ReadBuffer(const char*& buf, size_t& len) override {
+    if (!m_mappedData) {
+      return XML_InputSourceReaderFile::ReadBuffer(buf, len);
+    }
+    // hand out the rest of the mapped file at once
+    len = m_source->seekPos < m_size ? m_size - m_source->seekPos : 0;
+    buf = m_mappedData + m_source->seekPos;
+    m_source->seekPos += len;
+    return true;
+  }
+
+  size_t ReadLine(char* buf, size_t maxLen) override {
+    if (!m_mappedData) {
+      return XML_InputSourceReaderFile::ReadLine(buf, maxLen);
+    }
+    if (!buf || m_source->seekPos >= m_size) {
+      return 0;
+    }
+    size_t readSize = std::min(m_size - m_source->seekPos, maxLen);
+    memcpy(buf, m_mappedData + m_source->seekPos, readSize);
+    m_source->seekPos += readSize;
+    return readSize;
+  }
+
+protected:
+  XmlTypes::Err DoOpen() override {
+    if ((m_source->xmlString && strlen(m_source->xmlString) > 0) || !Map()) {
+      return XML_InputSourceReaderFile::DoOpen();
+    }
+    if (m_source->seekPos > m_size) {
+      return XmlTypes::Err::ERR_OPEN_FAILED;
+    }
+    m_bFile = true;
+    return XmlTypes::Err::ERR_NOERR;
+  }
+
+  bool Map() {
+#ifdef XML_READER_HAS_MMAP
+    if (m_source->fileName.empty()) {
+      return false;
+    }
+    int fd = open(m_source->fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);                                    // mapping stays valid after closing the descriptor
+    if (data == MAP_FAILED) {
+      return false;
+    }
+    madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+    m_mappedData = static_cast<const char*>(data);
+    m_size = (size_t)st.st_size;
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  void Unmap() {
+#ifdef XML_READER_HAS_MMAP
+    if (m_mappedData) {
+      munmap(const_cast<char*>(m_mappedData), m_size);
+    }
+#endif
+    m_mappedData = nullptr;
+  }
+
+protected:
+  const char* m_mappedData;
+};
+
+#endif // !XML_InputSourceReaderMappedFile_H
@@ -1,5 +1,5 @@
 /*
-* Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+* Copyright (c) 2020-2026 Arm Limited. All rights reserved.
 *
 * SPDX-License-Identifier: Apache-2.0
 */
@@ -148,6 +148,16 @@ public:
   */
   virtual size_t ReadLine(char* buf, size_t maxLen);
 
+  /**
+   * @brief provides direct access to the next portion of the input source without copying it
+   * @param buf returns pointer to the data, valid until the source is closed
+   * @param len returns length of the data, 0 if end of source is reached
+   * @return true if supported, false if ReadLine() must be used
+  */
+  virtual bool ReadBuffer(const char*& buf, size_t& len) {
+    return false;
+  }
+
   /**
    * @brief get size of input source (file or buffer)
    * @return size of input source
@@ -182,7 +192,8 @@ protected:
  *
  * Theory of operation:
  * An input file or buffer (e.g. running on WebAssembly) specifies the input buffer.
- * The reader acts as stream reader and buffers portions of the input file.
+ * The reader acts as stream reader and buffers portions of the input file,
+ * or scans the input directly if the input source reader provides it (see ReadBuffer()).
  * Once started, it runs on a "GetNext()" basis, returning the next XML element (see TagType), e.g.:
  * - begin or single tag
  *   -- flag is set if attributes are present
@@ -243,6 +254,14 @@ public:
   */
   bool GetNextNode(XmlTypes::XmlNode_t& node);
 
+  /**
+   * @brief skip content of the element started by the last node up to and including its end tag.
+   *        Skipped content is only scanned for nested tags, comments and quoted attribute values,
+   *        no nodes are created and the structure is not checked.
+   * @return success true/false, false if end of file is reached
+  */
+  bool SkipElement();
+
   /**
    * @brief get current line number
    * @return 1-based line number
@@ -410,6 +429,27 @@ private:
   */
   bool Getc(char& c);
 
+  /**
+   * @brief get next character and count lines
+   * @param c the next character
+   * @return success true/false
+  */
+  bool SkipChar(char& c);
+
+  /**
+   * @brief skip characters up to and including given terminator sequence
+   * @param terminator character sequence to search for
+   * @return success true/false
+  */
+  bool SkipTo(const char* terminator);
+
+  /**
+   * @brief skip rest of a declaration such as <!DOCTYPE ...> up to and including its closing '>',
+   *        ignoring '>' in quoted literals and in an internal subset [...] including its comments
+   * @return success true/false
+  */
+  bool SkipDeclaration();
+
   /**
    * @brief recalculates offset in current read buffer.
    * @param corr offset, e.g. -1
@@ -424,6 +464,7 @@ private:
   size_t m_streamBufLen;
   size_t m_streamBufMaxlen;
   char *m_streamBuf;
+  const char *m_streamData;       // points to m_streamBuf or directly into input source
 
   XmlTypes::XmlData_t m_xmlData;
   std::list <std::string> m_xmlTagStack;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -104,9 +104,11 @@ XML_Reader::XML_Reader(XML_InputSourceReader* inputSourceReader) :
   m_streamBufLen(0),
   m_streamBufMaxlen(MBYTE(2)),
   m_streamBuf(nullptr),
+  m_streamData(nullptr),
   m_InputSourceReader(inputSourceReader)
 {
   m_streamBuf = new char[m_streamBufMaxlen];
+  m_streamData = m_streamBuf;
 
   if(!inputSourceReader) {
     m_InputSourceReader = new XML_InputSourceReader();
@@ -184,6 +186,9 @@ Err XML_Reader::Init(const string& fileName, const std::string& xmlString)
   }
 
   m_SourceStack.clear();
+  m_xmlTagStack.clear();              // previous document could be left unfinished
+  m_bIsPrevText = false;
+  m_bPrevTagIsSingle = false;
 
   return NextSource(fileName, xmlString);
 }
@@ -311,7 +316,14 @@ size_t XML_Reader::ReadLine()
     return 0;
   }
 
-  size_t len = m_InputSourceReader->ReadLine(m_streamBuf, m_streamBufMaxlen);
+  size_t len = 0;
+  const char* data = nullptr;
+  if(m_InputSourceReader->ReadBuffer(data, len)) {
+    m_streamData = data;
+  } else {
+    len = m_InputSourceReader->ReadLine(m_streamBuf, m_streamBufMaxlen);
+    m_streamData = m_streamBuf;
+  }
   if(len == 0) {
     return 0;
   }
@@ -333,7 +345,7 @@ bool XML_Reader::Getc(char& c)
   }
 
   if(m_streamBufPos < m_streamBufLen) {
-    c = m_streamBuf[m_streamBufPos++];
+    c = m_streamData[m_streamBufPos++];
   }
 
   if(c == '\t') {
@@ -345,7 +357,7 @@ bool XML_Reader::Getc(char& c)
 
 void XML_Reader::CorrectCnt(int32_t corr)
 {
-  if((m_streamBufPos + corr) < m_streamBufMaxlen) {
+  if((m_streamBufPos + corr) < std::max(m_streamBufMaxlen, m_streamBufLen)) {
     m_streamBufPos += corr;
   }
 }
@@ -975,6 +987,156 @@ bool XML_Reader::ReadNextAttribute(bool bInorePrefixes)
   return foundAttribute;
 }
 
+bool XML_Reader::SkipChar(char& c)
+{
+  if(!Getc(c)) {
+    return false;
+  }
+  if(c == '\n') {
+    m_xmlData.lineNo++;
+  }
+  return true;
+}
+
+bool XML_Reader::SkipTo(const char* terminator)
+{
+  const size_t len = strlen(terminator);
+  string window;                        // last characters read, compared with terminator
+  char c = 0;
+  while(window.size() < len || window.compare(window.size() - len, len, terminator) != 0) {
+    if(!SkipChar(c)) {
+      return false;
+    }
+    if(window.size() == len) {
+      window.erase(0, 1);
+    }
+    window += c;
+  }
+  return true;
+}
+
+bool XML_Reader::SkipDeclaration()
+{
+  static const char commentStart[] = "<!--";
+  uint32_t brackets = 0;                // nesting depth of internal subset
+  size_t matched = 0;                   // characters of commentStart read in internal subset
+  char quote = 0;
+  char c = 0;
+  while(SkipChar(c)) {
+    if(quote) {
+      if(c == quote) {
+        quote = 0;
+      }
+      continue;
+    }
+    if(brackets > 0 && c == commentStart[matched]) {
+      if(++matched == sizeof(commentStart) - 1) {
+        matched = 0;
+        if(!SkipTo("-->")) {
+          return false;
+        }
+      }
+      continue;
+    }
+    matched = c == '<' ? 1 : 0;
+    switch(c) {
+      case '"':
+      case '\'':
+        quote = c;
+        break;
+      case '[':
+        brackets++;
+        break;
+      case ']':
+        if(brackets > 0) {
+          brackets--;
+        }
+        break;
+      case '>':
+        if(brackets == 0) {
+          return true;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
+bool XML_Reader::SkipElement()
+{
+  if(m_xmlData.type != TagType::TAG_BEGIN) {
+    return true;                        // single tag has no content
+  }
+
+  uint32_t depth = 1;
+  char c = 0;
+  while(depth > 0) {
+    if(!SkipChar(c)) {
+      return false;
+    }
+    if(c != '<') {
+      continue;
+    }
+    if(!SkipChar(c)) {
+      return false;
+    }
+    bool bOk = true;
+    if(c == '!') {                      // comment, CDATA section or declaration
+      char c1 = 0, c2 = 0;
+      bOk = SkipChar(c1);
+      if(bOk && c1 == '-') {
+        bOk = SkipChar(c2) && SkipTo(c2 == '-' ? "-->" : ">");
+      } else if(bOk && c1 == '[') {
+        bOk = SkipTo("]]>");
+      } else if(bOk && c1 != '>') {
+        bOk = SkipDeclaration();
+      }
+    } else if(c == '?') {               // processing instruction
+      bOk = SkipTo("?>");
+    } else if(c == '/') {               // end tag
+      bOk = SkipTo(">");
+      depth--;
+    } else {                            // begin or single tag, attribute values may contain '>'
+      char quote = 0;
+      char prev = c;
+      while(bOk) {
+        bOk = SkipChar(c);
+        if(!bOk) {
+          break;
+        }
+        if(quote) {
+          if(c == quote) {
+            quote = 0;
+          }
+        } else if(c == '"' || c == '\'') {
+          quote = c;
+        } else if(c == '>') {
+          if(prev != '/') {
+            depth++;
+          }
+          break;
+        }
+        prev = c;
+      }
+    }
+    if(!bOk) {
+      return false;
+    }
+  }
+
+  string xmlTag;
+  PopTag(xmlTag);
+  m_bIsPrevText = false;
+  m_bPrevTagIsSingle = false;
+  m_xmlData.type = TagType::TAG_END;
+  m_xmlData.attribute.clear();
+  m_xmlData.attrReadPos = 0;
+  m_xmlData.attrLen = 0;
+  return true;
+}
+
 bool XML_Reader::GetNextNode (XmlNode_t& node)
 {
   const bool bOk = NextEntry();
@@ -1,11 +1,14 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include "gtest/gtest.h"
 #include "XML_Reader.h"
+#include "XML_InputSourceReaderMappedFile.h"
+
+#include <fstream>
 
 using namespace std;
 
@@ -129,3 +132,109 @@ TEST(XmlReaderTest, ReadAttributes)
   EXPECT_FALSE(reader.HasAttributes());
   EXPECT_FALSE(reader.ReadNextAttribute(true));
 }
+
+TEST(XmlReaderTest, SkipElement)
+{
+  const string xmlString = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<root>\n"
+    "  <skipped attr=\"1\">\n"
+    "    <!-- <skipped> --->\n"
+    "    <![CDATA[ </skipped> ]]>\n"
+    "    <skipped><inner a=\"x>y\" b='</skipped>'/></skipped>\n"
+    "    <single/>\n"
+    "  </skipped>\n"
+    "  <single/>\n"
+    "  <next>text</next>\n"
+    "</root>\n";
+
+  XmlTypes::XmlNode_t node;
+  XML_Reader reader(nullptr);
+  EXPECT_EQ(XmlTypes::Err::ERR_NOERR, reader.Init("", xmlString));
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_EQ("root", node.tag);
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_EQ("skipped", node.tag);
+  EXPECT_EQ(XmlTypes::TagType::TAG_BEGIN, node.type);
+  EXPECT_TRUE(reader.SkipElement());
+  EXPECT_EQ(8, reader.GetLineNumber());
+
+  // single tag has no content to skip
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_EQ("single", node.tag);
+  EXPECT_EQ(XmlTypes::TagType::TAG_SINGLE, node.type);
+  EXPECT_TRUE(reader.SkipElement());
+
+  // reading continues with consistent tag stack
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_EQ("next", node.tag);
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_EQ("text", node.data);
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_EQ(XmlTypes::TagType::TAG_END, node.type);
+  EXPECT_EQ("next", node.tag);
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_EQ(XmlTypes::TagType::TAG_END, node.type);
+  EXPECT_EQ("root", node.tag);
+  EXPECT_FALSE(reader.GetNextNode(node));
+  EXPECT_TRUE(node.bEndOfFile);
+
+  // declaration with internal subset containing '>' in literals, nested brackets and comments
+  EXPECT_EQ(XmlTypes::Err::ERR_NOERR, reader.Init("", "<?xml version=\"1.0\"?>\n<root>\n<skipped>\n"
+    "<!DOCTYPE x [\n<!ENTITY e \"</skipped>\">\n<!-- ]> ' -->\n<![INCLUDE[ <!ATTLIST x a CDATA '>'> ]]>\n]>\n"
+    "</skipped>\n<next/>\n</root>\n"));
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_EQ("skipped", node.tag);
+  EXPECT_TRUE(reader.SkipElement());
+  EXPECT_EQ(9, reader.GetLineNumber());
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_EQ("next", node.tag);
+
+  // unterminated element
+  EXPECT_EQ(XmlTypes::Err::ERR_NOERR, reader.Init("", "<?xml version=\"1.0\"?>\n<root>\n<skipped>\n<a>\n</root>\n"));
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_TRUE(reader.GetNextNode(node));
+  EXPECT_EQ("skipped", node.tag);
+  EXPECT_FALSE(reader.SkipElement());
+}
+
+TEST(XmlReaderTest, ReadMappedFile)
+{
+  const string fileName = "XmlReaderTestMapped.xml";
+  {
+    ofstream file(fileName, ios::binary);
+    file << theXmlString;
+  }
+
+  XML_Reader stringReader(nullptr);
+  EXPECT_EQ(XmlTypes::Err::ERR_NOERR, stringReader.Init("", theXmlString));
+
+  XML_InputSourceReaderMappedFile* mappedSource = new XML_InputSourceReaderMappedFile();
+  XML_Reader fileReader(mappedSource);
+  EXPECT_EQ(XmlTypes::Err::ERR_NOERR, fileReader.Init(fileName, ""));
+#ifdef XML_READER_HAS_MMAP
+  EXPECT_TRUE(mappedSource->IsMapped());
+#endif
+
+  // both readers deliver the same nodes and attributes
+  XmlTypes::XmlNode_t node, fileNode;
+  do {
+    EXPECT_EQ(stringReader.GetNextNode(node), fileReader.GetNextNode(fileNode));
+    EXPECT_EQ(node.type, fileNode.type);
+    EXPECT_EQ(node.tag, fileNode.tag);
+    EXPECT_EQ(node.data, fileNode.data);
+    EXPECT_EQ(node.lineNo, fileNode.lineNo);
+    EXPECT_EQ(node.bEndOfFile, fileNode.bEndOfFile);
+    ASSERT_EQ(stringReader.HasAttributes(), fileReader.HasAttributes());
+    while (stringReader.HasAttributes() && stringReader.ReadNextAttribute()) {
+      EXPECT_TRUE(fileReader.ReadNextAttribute());
+      EXPECT_EQ(stringReader.GetAttributeTag(), fileReader.GetAttributeTag());
+      EXPECT_EQ(stringReader.GetAttributeData(), fileReader.GetAttributeData());
+    }
+  } while (!node.bEndOfFile && !fileNode.bEndOfFile);
+  EXPECT_TRUE(node.bEndOfFile);
+
+  fileReader.UnInit();
+  EXPECT_FALSE(mappedSource->IsMapped());
+  remove(fileName.c_str());
+}
@@ -11,7 +11,7 @@
 */
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -271,6 +271,20 @@ public:
   */
   void SetIgnoreTags(const std::set<std::string>& ignoreTags);
 
+  /**
+   * @brief set scan mode: only listed children of the root element are read, other children are skipped
+   *        without creating items and parsing stops as soon as each listed element is read.
+   *        Parser implementations without scan support read complete documents
+   * @param scanTags tags of root children to read, empty set to read complete documents (default)
+  */
+  void SetScanTags(const std::set<std::string>& scanTags);
+
+  /**
+   * @brief get description of the parser implementation and the settings that influence created items
+   * @return string with parser type, schema file and ignored and scanned tags
+  */
+  virtual std::string GetParseOptions() const;
+
   /**
    * @brief setter for member of type XMLTreeCallback
    * @param callback pointer to XMLTreeCallback instance to set
@@ -523,6 +537,12 @@ public:
   */
   void SetIgnoreTags(const std::set<std::string>& ignoreTags) { m_IgnoreTags = ignoreTags; }
 
+  /**
+   * @brief getter for tags to be ignored
+   * @return set of ignored tags
+  */
+  const std::set<std::string>& GetIgnoreTags() const { return m_IgnoreTags; }
+
   /**
    * @brief check if tag is to be ignored
    * @param tag name of tag to be checked
@@ -530,6 +550,18 @@ public:
   */
   bool IsTagIgnored(const std::string& tag) const;
 
+  /**
+   * @brief setter for tags of root children to read in scan mode
+   * @param scanTags tags to read, empty set to read complete documents
+  */
+  void SetScanTags(const std::set<std::string>& scanTags) { m_ScanTags = scanTags; }
+
+  /**
+   * @brief getter for tags of root children to read in scan mode
+   * @return set of tags, empty if complete documents are read
+  */
+  const std::set<std::string>& GetScanTags() const { return m_ScanTags; }
+
   /**
    * @brief set error or warning
    * @param msg message string for error or warning to set
@@ -565,6 +597,7 @@ protected:
   int m_nWarnings;
 
   std::set<std::string> m_IgnoreTags;
+  std::set<std::string> m_ScanTags;
 };
 
 class XMLTreeVisitor : public XmlItemVisitor<XMLTreeElement>
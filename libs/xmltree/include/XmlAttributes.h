@@ -0,0 +1,214 @@
+#ifndef XmlAttributes_H
+#define XmlAttributes_H
+/******************************************************************************/
+/*
+ * Copyright (c) 2025-2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <string>
+#include <map>
+#include <memory>
+#include <vector>
+#include <iterator>
+#include <initializer_list>
+
+class XmlStringPool;
+
+/**
+ * @brief counted reference to a string pool, half the size of std::shared_ptr
+*/
+class XmlStringPoolRef
+{
+public:
+  XmlStringPoolRef() noexcept : m_pool(nullptr) {};
+  explicit XmlStringPoolRef(XmlStringPool* pool) noexcept;
+  XmlStringPoolRef(const XmlStringPoolRef& other) noexcept : XmlStringPoolRef(other.m_pool) {};
+  XmlStringPoolRef(XmlStringPoolRef&& other) noexcept : m_pool(other.m_pool) { other.m_pool = nullptr; }
+  ~XmlStringPoolRef() { reset(); }
+
+  XmlStringPoolRef& operator=(const XmlStringPoolRef& other) noexcept;
+  XmlStringPoolRef& operator=(XmlStringPoolRef&& other) noexcept;
+  bool operator==(const XmlStringPoolRef& other) const { return m_pool == other.m_pool; }
+  bool operator!=(const XmlStringPoolRef& other) const { return m_pool != other.m_pool; }
+
+  XmlStringPool* get() const { return m_pool; }
+  XmlStringPool* operator->() const { return m_pool; }
+  void reset() noexcept;
+
+private:
+  XmlStringPool* m_pool;
+};
+
+/**
+ * @brief compact attribute collection: a vector of key-value string pointers sorted by key.
+ *        Strings belong to a pool shared by the collection, equal strings of one pool are stored only once
+ *        and can be compared by address. Collections stored in items use the global pool,
+ *        collections converted from std::map use a private pool until they are stored or modified.
+ *        ClearPool() starts a new global pool, the previous one is released with the last collection using it.
+ *        Each thread looks up recently interned strings in a small private cache before locking the global pool.
+ *        Provides read access compatible with std::map<std::string, std::string>.
+*/
+class XmlAttributes
+{
+public:
+  typedef std::pair<const std::string&, const std::string&> value_type;
+
+  /**
+   * @brief read-only iterator, dereferences to a pair of references to key and value
+  */
+  class const_iterator
+  {
+  public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef XmlAttributes::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef value_type reference;
+    struct pointer {
+      value_type m_entry;
+      const value_type* operator->() const { return &m_entry; }
+    };
+
+    const_iterator() noexcept {};
+    reference operator*() const { return reference(*m_it->first, *m_it->second); }
+    pointer operator->() const { return pointer{ **this }; }
+    const_iterator& operator++() { ++m_it; return *this; }
+    const_iterator operator++(int) { const_iterator it(*this); ++m_it; return it; }
+    bool operator==(const const_iterator& other) const { return m_it == other.m_it; }
+    bool operator!=(const const_iterator& other) const { return m_it != other.m_it; }
+
+  private:
+    friend class XmlAttributes;
+    typedef std::vector<std::pair<const std::string*, const std::string*> >::const_iterator base_iterator;
+    const_iterator(base_iterator it) : m_it(it) {};
+    base_iterator m_it;
+  };
+  typedef const_iterator iterator;
+
+  /**
+   * @brief default constructor
+  */
+  XmlAttributes() noexcept {};
+
+  /**
+   * @brief copy constructor, the copy shares the pool
+  */
+  XmlAttributes(const XmlAttributes& other) = default;
+
+  /**
+   * @brief move constructor
+  */
+  XmlAttributes(XmlAttributes&& other) noexcept = default;
+
+  /**
+   * @brief constructor from std::map, strings are copied to a private pool
+   * @param attributes map of name to value pairs
+  */
+  XmlAttributes(const std::map<std::string, std::string>& attributes);
+
+  /**
+   * @brief constructor from initializer list, strings are copied to a private pool
+   * @param attributes list of name to value pairs
+  */
+  XmlAttributes(std::initializer_list<std::pair<const std::string, std::string> > attributes);
+
+  /**
+   * @brief assignment operator, the collection shares the pool of the other one
+  */
+  XmlAttributes& operator=(const XmlAttributes& other) = default;
+
+  /**
+   * @brief move assignment operator
+  */
+  XmlAttributes& operator=(XmlAttributes&& other) noexcept = default;
+
+  /**
+   * @brief conversion to std::map
+   * @return map of name to value pairs
+  */
+  operator std::map<std::string, std::string>() const;
+
+  /**
+   * @brief equality operators, compare string addresses if both collections use the same pool
+  */
+  friend bool operator==(const XmlAttributes& lhs, const XmlAttributes& rhs);
+  friend bool operator!=(const XmlAttributes& lhs, const XmlAttributes& rhs) { return !(lhs == rhs); }
+
+  const_iterator begin() const { return const_iterator(m_entries.begin()); }
+  const_iterator end() const { return const_iterator(m_entries.end()); }
+  bool empty() const { return m_entries.empty(); }
+  size_t size() const { return m_entries.size(); }
+  void clear() { m_entries.clear(); m_pool.reset(); }
+
+  /**
+   * @brief find attribute by name
+   * @param name attribute name
+   * @return iterator to the key-value pair or end()
+  */
+  const_iterator find(const std::string& name) const;
+
+  /**
+   * @brief count attributes with given name
+   * @param name attribute name
+   * @return 1 if attribute exists, 0 otherwise
+  */
+  size_t count(const std::string& name) const { return find(name) != end() ? 1 : 0; }
+
+  /**
+   * @brief set attribute value, insert attribute if it does not exist
+   * @param name attribute name
+   * @param value attribute value
+  */
+  void set(const std::string& name, const std::string& value);
+
+  /**
+   * @brief remove attribute
+   * @param it iterator to attribute to remove
+  */
+  void erase(const_iterator it);
+
+  /**
+   * @brief remove attribute
+   * @param name attribute name
+   * @return number of removed attributes
+  */
+  size_t erase(const std::string& name);
+
+  /**
+   * @brief move strings to the global pool unless they are already there, called by items storing the collection
+  */
+  void InternStrings();
+
+  /**
+   * @brief check if strings of both collections belong to the same pool and can be compared by address
+   * @param other collection to compare with
+   * @return true if pools are the same
+  */
+  bool HasSamePool(const XmlAttributes& other) const { return m_pool == other.m_pool; }
+
+  /**
+   * @brief get string with the same value from the global pool
+   * @param s string to intern
+   * @return reference to pooled string, remains valid at least until ClearPool() is called
+  */
+  static const std::string& Intern(const std::string& s);
+
+  /**
+   * @brief start a new global pool, e.g. when the model is cleared.
+   *        Strings of the previous pool remain valid as long as collections refer to them.
+  */
+  static void ClearPool();
+
+private:
+  typedef std::pair<const std::string*, const std::string*> Entry;
+
+  std::vector<Entry>::iterator lower_bound(const std::string& name);
+  std::vector<Entry>::const_iterator lower_bound(const std::string& name) const;
+
+  std::vector<Entry> m_entries;
+  XmlStringPoolRef m_pool; // pool the strings belong to, keeps them alive
+};
+
+#endif // XmlAttributes_H
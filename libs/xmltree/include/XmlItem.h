@@ -14,6 +14,9 @@
  */
 /******************************************************************************/
 
+#include "XmlAttributes.h"
+#include "XmlItemArena.h"
+
 #include <string>
 #include <map>
 
@@ -53,13 +56,19 @@ public:
    * @brief parametrized constructor to instantiate with given attributes
    * @param attributes collection as key to value pairs
   */
-  explicit XmlItem(const std::map<std::string, std::string>& attributes) : m_attributes(attributes), m_lineNumber(0) {};
+  explicit XmlItem(const XmlAttributes& attributes) : m_attributes(attributes), m_lineNumber(0) { m_attributes.InternStrings(); };
 
   /**
    * @brief virtual destructor
   */
   virtual ~XmlItem() {};
 
+  /**
+   * @brief allocation functions, use XmlItemArena current for the calling thread if any
+  */
+  static void* operator new(size_t size) { return XmlItemArena::Allocate(size); }
+  static void operator delete(void* p) noexcept { XmlItemArena::Deallocate(p); }
+
   /**
    * @brief clears the item, default removes all attributes of the instance
   */
@@ -114,9 +123,9 @@ public:
 
   /**
    * @brief return collection of attributes as a key-value pairs
-   * @return map of name to value pairs
+   * @return collection of name to value pairs
   */
-  const std::map<std::string, std::string>& GetAttributes() const { return m_attributes; }
+  const XmlAttributes& GetAttributes() const { return m_attributes; }
 
   /**
   * @brief add missing attributes, optionally replace existing
@@ -124,7 +133,7 @@ public:
   * @param replaceExisting true to replace existing attributes
   * @return true if any attribute is set or changed
  */
-  bool AddAttributes(const std::map<std::string, std::string>& attributes, bool replaceExisting);
+  bool AddAttributes(const XmlAttributes& attributes, bool replaceExisting);
 
   /**
    * @brief add a single attribute to the item
@@ -156,7 +165,7 @@ public:
    * @param attributes collection as key to value pairs
    * @return true if any attribute collection has changed
   */
-  bool SetAttributes(const std::map<std::string, std::string>& attributes);
+  bool SetAttributes(const XmlAttributes& attributes);
 
   /**
    * @brief replace instance attributes with the given ones
@@ -427,7 +436,7 @@ public:
  * @param attributes given list of attributes
  * @return true if all given attributes exist in the instance
 */
-  virtual bool EqualAttributes(const std::map<std::string, std::string>& attributes) const;
+  virtual bool EqualAttributes(const XmlAttributes& attributes) const;
   /**
    * @brief check if all attributes of the given instance exist in this instance
    * @param other given instance of XmlItem
@@ -446,7 +455,7 @@ public:
  * @param attributes given list of attributes
  * @return true if given attributes exist in the instance
 */
-  virtual bool CompareAttributes(const std::map<std::string, std::string>& attributes) const;
+  virtual bool CompareAttributes(const XmlAttributes& attributes) const;
   /**
    * @brief check if attributes of the given instance exist in this instance
    * @param other given instance of XmlItem
@@ -502,7 +511,7 @@ protected:
 protected:
   std::string m_tag;  // item tag
   std::string m_text; // item text
-  std::map<std::string, std::string> m_attributes; // attribute key-value pairs
+  XmlAttributes m_attributes; // attribute key-value pairs, strings are interned in the global pool
 
   int m_lineNumber;  // 1 - based line number in XML file
 
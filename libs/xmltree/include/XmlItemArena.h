@@ -0,0 +1,111 @@
+#ifndef XmlItemArena_H
+#define XmlItemArena_H
+/******************************************************************************/
+/*
+ * Copyright (c) 2025-2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief bump-pointer memory arena for XmlItem objects created while a tree is parsed.
+ *        Blocks of deleted items are reused for new items of the same size.
+ *        An arena is released as a whole when its owner item is deleted, see SetOwner(),
+ *        or when the last item allocated from it is deleted if it has no owner.
+ *        Items created outside of an active Scope are allocated from the heap.
+*/
+class XmlItemArena
+{
+public:
+  /**
+   * @brief RAII object making a new arena current for the calling thread
+  */
+  class Scope
+  {
+  public:
+    /**
+     * @brief constructor, creates new arena and makes it current
+    */
+    Scope();
+
+    /**
+     * @brief destructor, restores previous arena and releases the created one if no items are left
+    */
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    XmlItemArena* m_arena;
+    XmlItemArena* m_previous;
+  };
+
+  /**
+   * @brief allocate memory for an item, from current arena if any or from the heap
+   * @param size number of bytes to allocate
+   * @return pointer to allocated memory
+  */
+  static void* Allocate(size_t size);
+
+  /**
+   * @brief deallocate memory obtained with Allocate()
+   * @param p pointer to memory to deallocate
+  */
+  static void Deallocate(void* p) noexcept;
+
+  /**
+   * @brief get arena current for the calling thread
+   * @return pointer to XmlItemArena or nullptr if no Scope is active
+  */
+  static XmlItemArena* GetCurrent();
+
+  /**
+   * @brief make the item just allocated from the current arena its owner, typically the root of a parsed tree.
+   *        Deleting the owner outside of a Scope releases the arena with all items allocated from it,
+   *        therefore these items must not outlive the owner.
+   * @param item pointer to the item, ignored if it is not the last item allocated from the current arena
+   * @return true if the item has become the owner
+  */
+  static bool SetOwner(const void* item);
+
+  /**
+   * @brief get number of bytes taken from the system by this arena
+   * @return number of bytes
+  */
+  size_t GetCapacity() const { return m_capacity; }
+
+  /**
+   * @brief get number of live items allocated from this arena
+   * @return number of items
+  */
+  size_t GetItemCount() const;
+
+private:
+  XmlItemArena();
+  ~XmlItemArena();
+
+  char* DoAllocate(size_t size);
+  bool DoDeallocate(char* block, size_t size); // returns true if the arena is to be deleted
+  bool ReleaseScope(); // returns true if the arena is to be deleted
+
+  static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+  mutable std::mutex m_mutex; // items can be deleted by another thread than the parsing one
+  size_t m_items; // live items
+  size_t m_scopes; // active Scope objects
+  const void* m_owner;
+  const void* m_lastItem;
+  std::vector<char*> m_freeLists; // heads of lists of free blocks, indexed by block size in alignment units
+  std::vector<char*> m_chunks;
+  char* m_pos;
+  char* m_end;
+  size_t m_capacity;
+};
+
+#endif // XmlItemArena_H
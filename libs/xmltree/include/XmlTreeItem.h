@@ -80,7 +80,7 @@ public:
    * @param parent pointer to parent element
    * @param attributes collection as key to value pairs
   */
-  XmlTreeItem(TITEM* parent, const std::map<std::string, std::string>& attributes) : XmlItem(attributes), m_parent(parent) {}
+  XmlTreeItem(TITEM* parent, const XmlAttributes& attributes) : XmlItem(attributes), m_parent(parent) {}
 
   /**
    * @brief destructor
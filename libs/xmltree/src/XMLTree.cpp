@@ -1,6 +1,6 @@
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -10,6 +10,8 @@
 
 #include "XmlTreeItemBuilder.h"
 
+#include <typeinfo>
+
 using namespace std;
 
 XMLTreeElement::XMLTreeElement(XMLTreeElement* parent) :
@@ -118,6 +120,33 @@ void XMLTree::SetIgnoreTags(const set<string>& ignoreTags)
   m_p->SetIgnoreTags(ignoreTags);
 }
 
+void XMLTree::SetScanTags(const set<string>& scanTags)
+{
+  if(m_p) {
+    m_p->SetScanTags(scanTags);
+  }
+}
+
+string XMLTree::GetParseOptions() const
+{
+  string options = typeid(*this).name();
+  options += ";schema=" + m_schemaFile;
+  if(m_schemaChecker) {
+    options += ";check";
+  }
+  if(m_p) {
+    options += ";ignore=";
+    for(auto& tag : m_p->GetIgnoreTags()) {
+      options += tag + ',';
+    }
+    options += ";scan=";
+    for(auto& tag : m_p->GetScanTags()) {
+      options += tag + ',';
+    }
+  }
+  return options;
+}
+
 bool XMLTree::Init()
 {
   if(!m_p) {
@@ -220,6 +249,8 @@ bool XMLTree::DoParse(const string& fileName, const std::string& xmlString)
     return false; // nothing to parse
   }
 
+  // items of the parsed tree share one arena, released when the last of them is deleted
+  XmlItemArena::Scope arenaScope;
   m_XmlItemBuilder->Clear();
   m_XmlItemBuilder->SetFileName(fileName);
   bool success = m_p->Parse(fileName, xmlString);
@@ -0,0 +1,275 @@
+/******************************************************************************/
+/*
+ * Copyright (c) 2025-2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "XmlAttributes.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+
+using namespace std;
+
+// global pool is split into shards to reduce lock contention when packs are parsed concurrently
+class XmlStringPool
+{
+public:
+  XmlStringPool(size_t shardCount, bool bShared) :
+    m_refCount(0), m_bShared(bShared), m_shardCount(shardCount), m_shards(new Shard[shardCount]) {}
+
+  const string& Intern(const string& s, size_t hashValue) {
+    Shard& shard = m_shards[hashValue % m_shardCount];
+    if (!m_bShared) {
+      // private pools are filled by the constructing collection before they are shared
+      return *shard.m_strings.insert(s).first;
+    }
+    lock_guard<mutex> lock(shard.m_mutex);
+    return *shard.m_strings.insert(s).first;
+  }
+
+  const string& Intern(const string& s) {
+    return Intern(s, hash<string>{}(s));
+  }
+
+  void AddRef() { m_refCount.fetch_add(1, memory_order_relaxed); }
+  bool Release() { return m_refCount.fetch_sub(1, memory_order_acq_rel) == 1; }
+
+private:
+  struct Shard {
+    mutex m_mutex;
+    unordered_set<string> m_strings; // node-based: string addresses remain stable
+  };
+  atomic<size_t> m_refCount;
+  bool m_bShared;
+  size_t m_shardCount;
+  unique_ptr<Shard[]> m_shards;
+};
+
+XmlStringPoolRef::XmlStringPoolRef(XmlStringPool* pool) noexcept :
+  m_pool(pool)
+{
+  if (m_pool) {
+    m_pool->AddRef();
+  }
+}
+
+XmlStringPoolRef& XmlStringPoolRef::operator=(const XmlStringPoolRef& other) noexcept
+{
+  if (m_pool != other.m_pool) {
+    XmlStringPoolRef copy(other);
+    std::swap(m_pool, copy.m_pool);
+  }
+  return *this;
+}
+
+XmlStringPoolRef& XmlStringPoolRef::operator=(XmlStringPoolRef&& other) noexcept
+{
+  if (this != &other) {
+    reset();
+    m_pool = other.m_pool;
+    other.m_pool = nullptr;
+  }
+  return *this;
+}
+
+void XmlStringPoolRef::reset() noexcept
+{
+  if (m_pool && m_pool->Release()) {
+    delete m_pool;
+  }
+  m_pool = nullptr;
+}
+
+namespace {
+
+constexpr size_t SHARD_COUNT = 64;
+constexpr size_t CACHE_SIZE = 4096; // power of two
+
+struct XmlGlobalPool
+{
+  mutex m_mutex;
+  XmlStringPoolRef m_pool = XmlStringPoolRef(new XmlStringPool(SHARD_COUNT, true));
+  atomic<size_t> m_generation{ 1 };
+};
+
+XmlGlobalPool& GetGlobalPool() {
+  // intentionally never destroyed: static XmlItem objects may use the global pool until program end
+  static XmlGlobalPool* globalPool = new XmlGlobalPool();
+  return *globalPool;
+}
+
+// each thread keeps a reference to the current pool, it is only updated after ClearPool()
+struct XmlThreadPool
+{
+  XmlStringPoolRef m_pool;
+  size_t m_generation = 0;
+  array<const string*, CACHE_SIZE> m_cache{}; // recently interned strings, direct-mapped by hash value
+
+  const string& Intern(const string& s) {
+    const size_t hashValue = hash<string>{}(s);
+    const string*& cached = m_cache[hashValue & (CACHE_SIZE - 1)];
+    if (!cached || *cached != s) {
+      cached = &m_pool->Intern(s, hashValue);
+    }
+    return *cached;
+  }
+};
+
+XmlThreadPool& GetCurrentPool() {
+  thread_local XmlThreadPool threadPool;
+  XmlGlobalPool& globalPool = GetGlobalPool();
+  if (threadPool.m_generation != globalPool.m_generation.load(memory_order_acquire)) {
+    lock_guard<mutex> lock(globalPool.m_mutex);
+    threadPool.m_pool = globalPool.m_pool;
+    threadPool.m_generation = globalPool.m_generation.load(memory_order_relaxed);
+    threadPool.m_cache.fill(nullptr);
+  }
+  return threadPool;
+}
+
+} // namespace
+
+const string& XmlAttributes::Intern(const string& s)
+{
+  return GetCurrentPool().Intern(s);
+}
+
+void XmlAttributes::ClearPool()
+{
+  XmlGlobalPool& globalPool = GetGlobalPool();
+  lock_guard<mutex> lock(globalPool.m_mutex);
+  globalPool.m_pool = XmlStringPoolRef(new XmlStringPool(SHARD_COUNT, true));
+  globalPool.m_generation++;
+}
+
+XmlAttributes::XmlAttributes(const map<string, string>& attributes)
+{
+  if (attributes.empty()) {
+    return;
+  }
+  // temporary collections, e.g. search patterns, do not add their strings to the global pool
+  m_pool = XmlStringPoolRef(new XmlStringPool(1, false));
+  m_entries.reserve(attributes.size());
+  for (auto& [a, v] : attributes) {
+    m_entries.emplace_back(&m_pool->Intern(a), &m_pool->Intern(v));
+  }
+}
+
+XmlAttributes::XmlAttributes(initializer_list<pair<const string, string> > attributes) :
+  XmlAttributes(map<string, string>(attributes))
+{
+}
+
+void XmlAttributes::InternStrings()
+{
+  XmlThreadPool& pool = GetCurrentPool();
+  if (m_entries.empty() || m_pool == pool.m_pool) {
+    return;
+  }
+  for (auto& entry : m_entries) {
+    entry.first = &pool.Intern(*entry.first);
+    entry.second = &pool.Intern(*entry.second);
+  }
+  m_pool = pool.m_pool;
+}
+
+XmlAttributes::operator map<string, string>() const
+{
+  map<string, string> attributes;
+  for (auto& [a, v] : m_entries) {
+    attributes.emplace_hint(attributes.end(), *a, *v);
+  }
+  return attributes;
+}
+
+bool operator==(const XmlAttributes& lhs, const XmlAttributes& rhs)
+{
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  const bool bSamePool = lhs.HasSamePool(rhs);
+  for (size_t i = 0; i < lhs.m_entries.size(); i++) {
+    auto& [la, lv] = lhs.m_entries[i];
+    auto& [ra, rv] = rhs.m_entries[i];
+    if (bSamePool ? (la != ra || lv != rv) : (*la != *ra || *lv != *rv)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+vector<XmlAttributes::Entry>::iterator XmlAttributes::lower_bound(const string& name)
+{
+  return std::lower_bound(m_entries.begin(), m_entries.end(), name,
+    [](const Entry& entry, const string& key) { return *entry.first < key; });
+}
+
+vector<XmlAttributes::Entry>::const_iterator XmlAttributes::lower_bound(const string& name) const
+{
+  return std::lower_bound(m_entries.begin(), m_entries.end(), name,
+    [](const Entry& entry, const string& key) { return *entry.first < key; });
+}
+
+XmlAttributes::const_iterator XmlAttributes::find(const string& name) const
+{
+  auto it = lower_bound(name);
+  if (it != m_entries.end() && *it->first == name) {
+    return const_iterator(it);
+  }
+  return end();
+}
+
+void XmlAttributes::set(const string& name, const string& value)
+{
+  auto it = lower_bound(name);
+  const bool bExists = it != m_entries.end() && *it->first == name;
+  if (bExists && *it->second == value) {
+    return;
+  }
+  // modified collections use the global pool, name and value may refer to the previous one
+  const size_t index = it - m_entries.begin();
+  XmlThreadPool& pool = GetCurrentPool();
+  XmlStringPoolRef previous;
+  if (m_pool != pool.m_pool) {
+    previous = std::move(m_pool);
+    m_pool = pool.m_pool;
+    for (auto& entry : m_entries) {
+      entry.first = &pool.Intern(*entry.first);
+      entry.second = &pool.Intern(*entry.second);
+    }
+  }
+  if (bExists) {
+    m_entries[index].second = &pool.Intern(value);
+  } else {
+    m_entries.emplace(m_entries.begin() + index, &pool.Intern(name), &pool.Intern(value));
+  }
+}
+
+void XmlAttributes::erase(const_iterator it)
+{
+  if (it == end()) {
+    return;
+  }
+  m_entries.erase(it.m_it);
+  if (m_entries.empty()) {
+    m_pool.reset();
+  }
+}
+
+size_t XmlAttributes::erase(const string& name)
+{
+  auto it = find(name);
+  if (it == end()) {
+    return 0;
+  }
+  erase(it);
+  return 1;
+}
+
+// End of XmlAttributes.cpp
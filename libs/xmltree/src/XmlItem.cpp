@@ -27,7 +27,7 @@ void XmlItem::ClearAttributes()
   }
 }
 
-bool XmlItem::AddAttributes(const map<string, string>& attributes, bool replaceExisting)
+bool XmlItem::AddAttributes(const XmlAttributes& attributes, bool replaceExisting)
 {
   if (attributes.empty())
     return false;
@@ -53,7 +53,7 @@ bool XmlItem::AddAttribute(const string& name, const string& value, bool insertE
 {
   if (name.empty())
     return false;
-  map<string, string>::iterator it = m_attributes.find(name);
+  auto it = m_attributes.find(name);
   if (it != m_attributes.end()) {
     if (it->second == value)
       return false;
@@ -64,7 +64,7 @@ bool XmlItem::AddAttribute(const string& name, const string& value, bool insertE
   }
 
   if(insertEmpty || !value.empty()) {
-    m_attributes[name] = value;
+    m_attributes.set(name, value);
     return true;
   }
   return false;
@@ -74,14 +74,14 @@ bool XmlItem::SetAttribute(const char* name, const char* value)
 {
   if (!name)
     return false;
-  map<string, string>::iterator it = m_attributes.find(name);
+  auto it = m_attributes.find(name);
   if (it != m_attributes.end()) {
     if (value && it->second == value)
       return false;
     m_attributes.erase(it);
   }
   if (value) {
-    m_attributes[name] = value;
+    m_attributes.set(name, value);
   }
   return true;
 }
@@ -91,12 +91,13 @@ bool XmlItem::SetAttribute(const char* name, long value, int radix)
   return SetAttribute(name, RteUtils::LongToString(value, radix).c_str());
 }
 
-bool XmlItem::SetAttributes(const map<string, string>& attributes)
+bool XmlItem::SetAttributes(const XmlAttributes& attributes)
 {
   if (m_attributes == attributes)
     return false;
 
   m_attributes = attributes;
+  m_attributes.InternStrings();
   ProcessAttributes();
   return true;
 }
@@ -113,12 +114,7 @@ bool XmlItem::AssignAttribute(const std::string& name, const XmlItem& from) {
 
 bool XmlItem::RemoveAttribute(const std::string& name)
 {
-  map<string, string>::iterator it = m_attributes.find(name);
-  if (it != m_attributes.end()) {
-    m_attributes.erase(it);
-    return true;
-  }
-  return false;
+  return m_attributes.erase(name) > 0;
 }
 
 bool XmlItem::RemoveAttribute(const char* name)
@@ -155,7 +151,7 @@ const string& XmlItem::GetAttribute(const char* name) const
 
 const string& XmlItem::GetAttribute(const string& name) const
 {
-  map<string, string>::const_iterator it = m_attributes.find(name);
+  auto it = m_attributes.find(name);
   if (it != m_attributes.end())
     return it->second;
   return EMPTY_STRING;
@@ -289,7 +285,6 @@ int XmlItem::GetItemValueAsInt(const std::string& keyOrTag, int defaultValue) co
 string XmlItem::GetAttributesString(bool quote) const
 {
   string s;
-  map<string, string>::const_iterator it;
   for (auto [a, v] : m_attributes) {
     if (!s.empty())
       s += " ";
@@ -311,14 +306,15 @@ string XmlItem::GetAttributesAsXmlString() const
   return GetAttributesString(true);
 }
 
-bool XmlItem::EqualAttributes(const map<string, string>& attributes) const
+bool XmlItem::EqualAttributes(const XmlAttributes& attributes) const
 {
   // all supplied attributes must exist in this ones
+  const bool bSamePool = m_attributes.HasSamePool(attributes);
   for (auto [a, v] : attributes) {
     auto itm = m_attributes.find(a);
     if (itm != m_attributes.end()) {
       const string& va = itm->second;
-      if (va != v)
+      if (bSamePool ? &va != &v : va != v) // strings of one pool are unique
         return false;
     } else {
       return false;
@@ -342,7 +338,7 @@ bool XmlItem::EqualAttributes(const XmlItem* other) const
 }
 
 
-bool XmlItem::CompareAttributes(const map<string, string>& attributes) const
+bool XmlItem::CompareAttributes(const XmlAttributes& attributes) const
 {
   // all supplied attributes must exist in this ones
   for (auto [a, v] : attributes) {
@@ -0,0 +1,175 @@
+/******************************************************************************/
+/*
+ * Copyright (c) 2025-2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "XmlItemArena.h"
+
+#include <new>
+
+using namespace std;
+
+namespace {
+
+// every block is preceded by a header referring to the owning arena (nullptr for heap blocks)
+struct BlockHeader {
+  XmlItemArena* arena;
+  size_t size; // block size including header
+};
+
+constexpr size_t ALIGNMENT = alignof(max_align_t);
+
+constexpr size_t AlignUp(size_t size) {
+  return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+constexpr size_t HEADER_SIZE = AlignUp(sizeof(BlockHeader));
+
+thread_local XmlItemArena* s_currentArena = nullptr;
+
+} // namespace
+
+XmlItemArena::Scope::Scope() :
+  m_arena(new XmlItemArena()),
+  m_previous(s_currentArena)
+{
+  s_currentArena = m_arena;
+}
+
+XmlItemArena::Scope::~Scope()
+{
+  s_currentArena = m_previous;
+  if (m_arena->ReleaseScope()) {
+    delete m_arena;
+  }
+}
+
+XmlItemArena::XmlItemArena() :
+  m_items(0),
+  m_scopes(1),
+  m_owner(nullptr),
+  m_lastItem(nullptr),
+  m_pos(nullptr),
+  m_end(nullptr),
+  m_capacity(0)
+{
+}
+
+XmlItemArena::~XmlItemArena()
+{
+  for (auto chunk : m_chunks) {
+    ::operator delete(chunk);
+  }
+}
+
+XmlItemArena* XmlItemArena::GetCurrent()
+{
+  return s_currentArena;
+}
+
+bool XmlItemArena::SetOwner(const void* item)
+{
+  XmlItemArena* arena = s_currentArena;
+  if (!arena || !item) {
+    return false;
+  }
+  lock_guard<mutex> lock(arena->m_mutex);
+  // comparing with the last allocated item ensures the header in front of the item belongs to this arena
+  if (arena->m_owner || arena->m_lastItem != item) {
+    return false;
+  }
+  arena->m_owner = item;
+  return true;
+}
+
+size_t XmlItemArena::GetItemCount() const
+{
+  lock_guard<mutex> lock(m_mutex);
+  return m_items;
+}
+
+bool XmlItemArena::ReleaseScope()
+{
+  lock_guard<mutex> lock(m_mutex);
+  return --m_scopes == 0 && m_items == 0;
+}
+
+char* XmlItemArena::DoAllocate(size_t size)
+{
+  lock_guard<mutex> lock(m_mutex);
+  char* block = nullptr;
+  const size_t index = size / ALIGNMENT;
+  if (index < m_freeLists.size() && m_freeLists[index]) {
+    // free blocks keep the link to the next one in place of the item
+    block = m_freeLists[index];
+    m_freeLists[index] = *reinterpret_cast<char**>(block + HEADER_SIZE);
+  } else {
+    if (static_cast<size_t>(m_end - m_pos) < size) {
+      const size_t chunkSize = size > CHUNK_SIZE ? size : CHUNK_SIZE;
+      char* chunk = static_cast<char*>(::operator new(chunkSize));
+      m_chunks.push_back(chunk);
+      m_capacity += chunkSize;
+      m_pos = chunk;
+      m_end = chunk + chunkSize;
+    }
+    block = m_pos;
+    m_pos += size;
+  }
+  m_items++;
+  m_lastItem = block + HEADER_SIZE;
+  return block;
+}
+
+bool XmlItemArena::DoDeallocate(char* block, size_t size)
+{
+  lock_guard<mutex> lock(m_mutex);
+  char* item = block + HEADER_SIZE;
+  if (item == m_lastItem) {
+    m_lastItem = nullptr;
+  }
+  if (item == m_owner) {
+    m_owner = nullptr;
+    if (m_scopes == 0) {
+      return true; // owner releases the arena together with all remaining items
+    }
+  }
+  if (--m_items == 0 && m_scopes == 0) {
+    return true;
+  }
+  const size_t index = size / ALIGNMENT;
+  if (index >= m_freeLists.size()) {
+    m_freeLists.resize(index + 1, nullptr);
+  }
+  *reinterpret_cast<char**>(item) = m_freeLists[index];
+  m_freeLists[index] = block;
+  return false;
+}
+
+void* XmlItemArena::Allocate(size_t size)
+{
+  XmlItemArena* arena = s_currentArena;
+  const size_t blockSize = HEADER_SIZE + AlignUp(size > 0 ? size : 1);
+  char* block = arena ? arena->DoAllocate(blockSize) : static_cast<char*>(::operator new(blockSize));
+  new (block) BlockHeader{ arena, blockSize };
+  return block + HEADER_SIZE;
+}
+
+void XmlItemArena::Deallocate(void* p) noexcept
+{
+  if (!p) {
+    return;
+  }
+  char* block = static_cast<char*>(p) - HEADER_SIZE;
+  const BlockHeader* header = reinterpret_cast<const BlockHeader*>(block);
+  XmlItemArena* arena = header->arena;
+  if (!arena) {
+    ::operator delete(block);
+  } else if (arena->DoDeallocate(block, header->size)) {
+    delete arena;
+  }
+}
+
+// End of XmlItemArena.cpp
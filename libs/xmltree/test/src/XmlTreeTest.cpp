@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -99,4 +99,123 @@ TEST(XmlTreeTest, GetAttribute) {
   EXPECT_EQ(e1->GetRootFileName(), "e1/foo.bar");
   EXPECT_EQ(e2->GetRootFileName(), "e1/foo.bar");
 }
+
+TEST(XmlTreeTest, Attributes) {
+
+  const std::string& s1 = XmlAttributes::Intern("value");
+  const std::string& s2 = XmlAttributes::Intern(std::string("val") + "ue");
+  EXPECT_EQ(&s1, &s2);
+
+  XmlAttributes attributes;
+  EXPECT_TRUE(attributes.empty());
+  attributes.set("c", "3");
+  attributes.set("a", "1");
+  attributes.set("b", "2");
+  attributes.set("a", "0");
+  EXPECT_EQ(attributes.size(), 3);
+  std::string keys;
+  for (auto [a, v] : attributes) {
+    keys += a + "=" + v + " ";
+  }
+  EXPECT_EQ(keys, "a=0 b=2 c=3 ");
+  EXPECT_EQ(attributes.count("b"), 1);
+  EXPECT_EQ(attributes.count("d"), 0);
+  EXPECT_TRUE(attributes.find("d") == attributes.end());
+  EXPECT_EQ(attributes.find("c")->second, "3");
+
+  const std::map<std::string, std::string> m = attributes;
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_EQ(m.at("a"), "0");
+  XmlAttributes copy(m);
+  EXPECT_TRUE(copy == attributes);
+  EXPECT_TRUE(m == attributes);
+
+  EXPECT_EQ(attributes.erase("b"), 1);
+  EXPECT_EQ(attributes.erase("b"), 0);
+  EXPECT_TRUE(copy != attributes);
+  attributes.erase(attributes.find("a"));
+  EXPECT_EQ(attributes.size(), 1);
+  EXPECT_EQ(attributes.begin()->first, "c");
+
+  XMLTreeElement e;
+  e.SetAttributes(copy);
+  EXPECT_TRUE(e.EqualAttributes(copy));
+  EXPECT_TRUE(e.EqualAttributes(m));
+  EXPECT_TRUE(e.EqualAttributes(attributes)); // subset
+  attributes.set("c", "5");
+  EXPECT_FALSE(e.EqualAttributes(attributes));
+  e.SetAttribute("b", "4");
+  EXPECT_EQ(copy.find("b")->second, "2");
+  EXPECT_EQ(e.GetAttribute("b"), "4");
+
+  // collections converted from std::map use the global pool only once stored in an item
+  XmlAttributes query({ { "q", "query" } });
+  EXPECT_FALSE(query.HasSamePool(attributes));
+  XMLTreeElement q;
+  q.SetAttributes(query);
+  EXPECT_TRUE(q.GetAttributes().HasSamePool(attributes));
+  EXPECT_TRUE(q.GetAttributes() == query);
+
+  // strings of the previous pool stay valid while used
+  XmlAttributes::ClearPool();
+  XmlAttributes fresh;
+  fresh.set("q", "query");
+  EXPECT_FALSE(fresh.HasSamePool(q.GetAttributes()));
+  EXPECT_TRUE(fresh == q.GetAttributes());
+  EXPECT_TRUE(q.EqualAttributes(fresh));
+  EXPECT_EQ(e.GetAttribute("c"), "3");
+}
+
+TEST(XmlTreeTest, ItemArena) {
+
+  EXPECT_TRUE(XmlItemArena::GetCurrent() == nullptr);
+  XMLTreeElement* heapItem = new XMLTreeElement(nullptr, "heap");
+  XMLTreeElement* root = nullptr;
+  {
+    XmlItemArena::Scope scope;
+    XmlItemArena* arena = XmlItemArena::GetCurrent();
+    ASSERT_TRUE(arena != nullptr);
+    root = new XMLTreeElement(nullptr, "root");
+    for (int i = 0; i < 1000; i++) {
+      XMLTreeElement* child = root->CreateElement("child");
+      child->AddAttribute("index", RteUtils::LongToString(i));
+    }
+    EXPECT_GT(arena->GetCapacity(), 0);
+    {
+      XmlItemArena::Scope nested;
+      EXPECT_TRUE(XmlItemArena::GetCurrent() != arena);
+    }
+    EXPECT_TRUE(XmlItemArena::GetCurrent() == arena);
+  }
+  EXPECT_TRUE(XmlItemArena::GetCurrent() == nullptr);
+  // items outlive the scope
+  EXPECT_EQ(root->GetChildren().size(), 1000);
+  EXPECT_EQ(root->GetChildren().back()->GetAttribute("index"), "999");
+  root->AddChild(heapItem);
+  delete root; // releases the arena together with the last item
+
+  {
+    XmlItemArena::Scope scope;
+    XmlItemArena* arena = XmlItemArena::GetCurrent();
+    root = new XMLTreeElement(nullptr, "root");
+    EXPECT_TRUE(XmlItemArena::SetOwner(root));
+    XMLTreeElement* child = root->CreateElement("child");
+    EXPECT_FALSE(XmlItemArena::SetOwner(child)); // arena has already an owner
+    EXPECT_EQ(arena->GetItemCount(), 2);
+    // blocks of deleted items are reused
+    const size_t capacity = arena->GetCapacity();
+    for (int i = 0; i < 10000; i++) {
+      root->RemoveChild(child, true);
+      child = root->CreateElement("child");
+    }
+    EXPECT_EQ(arena->GetCapacity(), capacity);
+    EXPECT_EQ(arena->GetItemCount(), 2);
+    // only the last allocated item can become the owner
+    XmlItemArena::Scope nested;
+    XMLTreeElement stackItem(nullptr, "stack");
+    EXPECT_FALSE(XmlItemArena::SetOwner(&stackItem));
+  }
+  // deleting the owner releases the arena with all its items
+  delete root;
+}
 // end of XmlTreeTest.cpp
@@ -1,6 +1,6 @@
 /******************************************************************************/
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -110,12 +110,14 @@ bool XMLTreeSlimInterface::Parse(const std::string& fileName, const std::string&
   m_nWarnings = 0;
 
   ErrLog::Get()->SetFileName(fileName);
-  IErrConsumer* prevConsumer = ErrLog::Get()->GetErrConsumer();
+  // redirect messages of this thread only, other threads may parse concurrently
+  IErrConsumer* prevConsumer = ErrLog::Get()->GetThreadErrConsumer();
   if (m_errConsumer) {
-    ErrLog::Get()->SetErrConsumer(m_errConsumer);
+    ErrLog::Get()->SetThreadErrConsumer(m_errConsumer);
   }
 
   m_xmlFile = fileName;
+  m_scanTagsRead.clear();
 
   XmlTypes::Err err = m_pXmlReader->Init(fileName, xmlString);
   if (err != XmlTypes::Err::ERR_NOERR) {
@@ -136,7 +138,7 @@ bool XMLTreeSlimInterface::Parse(const std::string& fileName, const std::string&
 
   m_pXmlReader->UnInit();
 
-  ErrLog::Get()->SetErrConsumer(prevConsumer);
+  ErrLog::Get()->SetThreadErrConsumer(prevConsumer);
   ErrLog::Get()->SetFileName("");
 
   m_xmlFile = "";
@@ -205,9 +207,19 @@ bool XMLTreeSlimInterface::DoParseElement(XmlTypes::XmlNode_t& elementNode)
     switch (node.type) {
     case TagType::TAG_BEGIN:
     case TagType::TAG_SINGLE:
+      if (IsTagSkipped(node.tag)) {
+        if (!m_pXmlReader->SkipElement()) {
+          return false;
+        }
+        break;
+      }
       if (!ParseElement(node)) {
         return false;
       }
+      if (recursion == 1 && IsScanComplete(node.tag)) {
+        recursion--;
+        return true; // all requested root children are read, ignore the rest of the document
+      }
     break;
 
     case TagType::TAG_TEXT: {
@@ -229,3 +241,21 @@ bool XMLTreeSlimInterface::DoParseElement(XmlTypes::XmlNode_t& elementNode)
 
   return true;
 }
+
+bool XMLTreeSlimInterface::IsTagSkipped(const string& tag) const
+{
+  if (IsTagIgnored(tag)) {
+    return true;
+  }
+  // in scan mode only requested children of the root element are read
+  return recursion == 1 && !m_ScanTags.empty() && m_ScanTags.find(tag) == m_ScanTags.end();
+}
+
+bool XMLTreeSlimInterface::IsScanComplete(const string& tag)
+{
+  if (m_ScanTags.empty() || m_ScanTags.find(tag) == m_ScanTags.end()) {
+    return false;
+  }
+  m_scanTagsRead.insert(tag);
+  return m_scanTagsRead.size() == m_ScanTags.size();
+}
@@ -60,6 +60,8 @@ private:
   bool ParseElement(XmlTypes::XmlNode_t &node);
   bool DoParseElement(XmlTypes::XmlNode_t &node);
   void ReadAttributes(const std::string& tag);
+  bool IsTagSkipped(const std::string& tag) const;
+  bool IsScanComplete(const std::string& tag);
 
   void InitMessageTable();
   void InitMessageTableStrict();
@@ -67,6 +69,7 @@ private:
   XML_Reader* m_pXmlReader;
   bool m_bIgnoreAttributePrefixes;
   int recursion;
+  std::set<std::string> m_scanTagsRead; // requested root children read in scan mode
 
   IErrConsumer* m_errConsumer;
 
@@ -151,6 +151,48 @@ TEST_F(XmlTreeSlimTest, ReadStringXmlns) {
   EXPECT_EQ(theXmlString, xmlContent);
 }
 
+TEST_F(XmlTreeSlimTest, ScanTags) {
+
+  XMLTreeSlim tree(nullptr, true);
+  tree.SetScanTags({ "info", "special_chars" });
+  EXPECT_TRUE(tree.ParseString(theXmlString));
+  EXPECT_FALSE(tree.HasErrors());
+  XMLTreeElement* root = tree.GetRoot() ? tree.GetRoot()->GetFirstChild() : nullptr;
+  ASSERT_TRUE(root);
+  EXPECT_EQ("cprj", root->GetTag());
+  EXPECT_EQ(schemaVer, root->GetAttribute("schemaVersion"));
+  // only requested children are read, parsing stops after the last one
+  ASSERT_EQ(2, root->GetChildCount());
+  EXPECT_EQ("information", root->GetChildText("info"));
+  XMLTreeElement* specialChars = root->GetFirstChild("special_chars");
+  ASSERT_TRUE(specialChars);
+  EXPECT_EQ("&", specialChars->GetAttribute("amp"));
+  EXPECT_FALSE(root->GetFirstChild("child"));
+  EXPECT_FALSE(root->GetFirstChild("special_chars_in_text"));
+
+  // ignored tags are skipped at any level
+  XMLTreeSlim ignoreTree(nullptr, true);
+  ignoreTree.SetIgnoreTags({ "subchild" });
+  EXPECT_TRUE(ignoreTree.ParseString(theXmlString));
+  root = ignoreTree.GetRoot() ? ignoreTree.GetRoot()->GetFirstChild() : nullptr;
+  ASSERT_TRUE(root);
+  EXPECT_EQ(5, root->GetChildCount());
+  for (auto child : root->GetChildren()) {
+    EXPECT_FALSE(child->GetFirstChild("subchild"));
+  }
+  XMLTreeElement* child = root->GetFirstChild("child");
+  ASSERT_TRUE(child);
+  EXPECT_EQ("subtext1", child->GetChildText("subtext"));
+
+  // reset scan mode reads complete documents
+  tree.Clear();
+  tree.SetScanTags({});
+  EXPECT_TRUE(tree.ParseString(theXmlString));
+  root = tree.GetRoot() ? tree.GetRoot()->GetFirstChild() : nullptr;
+  ASSERT_TRUE(root);
+  EXPECT_EQ(5, root->GetChildCount());
+}
+
 TEST_F(XmlTreeSlimTest, ReadFileStringFail) {
 
   bool success = RteFsUtils::CopyBufferToFile(xmlIn, theXmlString, false);
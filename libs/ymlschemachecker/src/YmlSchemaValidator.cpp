@@ -9,11 +9,32 @@
 #include "RteUtils.h"
 #include "YmlSchemaCheckerUtils.h"
 
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <mutex>
 
 using nlohmann::json_schema::json_validator;
 
+typedef std::vector<std::pair<std::string, std::filesystem::file_time_type>> SchemaFiles;
+
+// compiled schema with the modification times of the root schema and all referenced schemas
+struct CompiledSchema {
+  SchemaFiles files;
+  std::shared_ptr<const json_validator> validator;
+};
+
+// compiled schemas are kept for the process lifetime and reused while their files are unchanged
+static std::map<std::string, CompiledSchema> theCompiledSchemas;
+static std::mutex theCompiledSchemasMutex;
+
+static std::filesystem::file_time_type GetModificationTime(const std::string& filename) {
+  std::error_code ec;
+  const auto time = std::filesystem::last_write_time(filename, ec);
+  return ec ? std::filesystem::file_time_type::min() : time;
+}
+
 YmlSchemaValidator::YmlSchemaValidator(
   const std::string& dataFilePath,
   const std::string& schemaFilePath):
@@ -156,44 +177,76 @@ nlohmann::json YmlSchemaValidator::ParseScalar(const YAML::Node& node) {
   return nullptr;
 }
 
-bool YmlSchemaValidator::Validate(std::list<RteError>& errList) {
-  json data, schema;
-
-  // 1) Read the data and schema for the document you want to validate
-  try {
-    data = ReadData();
-    schema = ReadSchema();
-  }
-  catch (const RteError& err) {
-    errList.push_back(err);
-    return false;
+std::shared_ptr<const json_validator> YmlSchemaValidator::GetValidator() {
+  {
+    std::lock_guard<std::mutex> lock(theCompiledSchemasMutex);
+    const auto it = theCompiledSchemas.find(m_schemaFile);
+    if (it != theCompiledSchemas.end()) {
+      bool unchanged = true;
+      for (const auto& [filename, time] : it->second.files) {
+        if (GetModificationTime(filename) != time) {
+          unchanged = false;
+          break;
+        }
+      }
+      if (unchanged) {
+        return it->second.validator;
+      }
+    }
   }
-  // 2) create the validator
-  nlohmann::json_schema::schema_loader loader =
-    std::bind(&YmlSchemaValidator::Loader, this, std::placeholders::_1, std::placeholders::_2);
-  json_validator validator(loader, nlohmann::json_schema::default_string_format_check);
+
+  // modification times are taken before reading, a file changed meanwhile is compiled again next time
+  auto files = std::make_shared<SchemaFiles>();
+  files->push_back({ m_schemaFile, GetModificationTime(m_schemaFile) });
+  json schema = ReadSchema();
+
+  // create the validator, the loader is only called while setting the root schema
+  const std::string schemaPath = RteUtils::ExtractFilePath(m_schemaFile, true);
+  nlohmann::json_schema::schema_loader loader = [schemaPath, files](const json_uri& uri, json& schema) {
+    const std::string filename = schemaPath + uri.path();
+    files->push_back({ filename, GetModificationTime(filename) });
+    Loader(filename, uri, schema);
+  };
+  auto validator = std::make_shared<json_validator>(loader, nlohmann::json_schema::default_string_format_check);
 
   try {
     // insert this schema as the root to the validator
     // this resolves remote-schemas, sub-schemas and references via the given loader-function
-    validator.set_root_schema(schema);
+    validator->set_root_schema(schema);
   }
   catch (const std::exception& e) {
-    errList.push_back(RteError(m_schemaFile, e.what(), 0, 0));
+    throw RteError(m_schemaFile, e.what(), 0, 0);
+  }
+
+  std::lock_guard<std::mutex> lock(theCompiledSchemasMutex);
+  theCompiledSchemas[m_schemaFile] = { *files, validator };
+  return validator;
+}
+
+bool YmlSchemaValidator::Validate(std::list<RteError>& errList) {
+  json data;
+  std::shared_ptr<const json_validator> validator;
+
+  // 1) Read the data and get the compiled validator of the schema
+  try {
+    data = ReadData();
+    validator = GetValidator();
+  }
+  catch (const RteError& err) {
+    errList.push_back(err);
     return false;
   }
 
-  // 3) do the actual validation of the data
+  // 2) do the actual validation of the data, a compiled validator may be shared by concurrent validations
   YmlSchemaErrorHandler handler(m_dataFile);
-  validator.validate(data, handler);
+  validator->validate(data, handler);
 
   errList = handler.GetAllErrors();
   return (errList.size() == 0) ? true : false;
 }
 
-void YmlSchemaValidator::Loader(const json_uri& uri, json& schema)
+void YmlSchemaValidator::Loader(const std::string& filename, const json_uri& uri, json& schema)
 {
-  std::string filename = RteUtils::ExtractFilePath(m_schemaFile, true) + uri.path();
   std::ifstream lf(filename);
   if (!lf.good()) {
     throw RteError(filename, "could not open " + uri.url(), 0, 0);
@@ -13,6 +13,7 @@
 #include <nlohmann/json-schema.hpp>
 #include "YmlSchemaCheckerUtils.h"
 
+#include <memory>
 #include <string>
 
 using nlohmann::json;
@@ -34,8 +35,9 @@ public:
 private:
   json ReadData();
   json ReadSchema();
+  std::shared_ptr<const nlohmann::json_schema::json_validator> GetValidator();
 
-  void Loader(const json_uri& uri, json& schema);
+  static void Loader(const std::string& filename, const json_uri& uri, json& schema);
 
   nlohmann::json YamlToJson(const YAML::Node& root);
   nlohmann::json ParseScalar(const YAML::Node& node);
@@ -7,6 +7,7 @@
 #include "YmlSchemaChecker.h"
 #include "YmlSchemaChkTestEnv.h"
 #include "YmlTree.h"
+#include "RteFsUtils.h"
 
 #include "gtest/gtest.h"
 
@@ -91,6 +92,41 @@ TEST_F(YmlSchemaChkTests, Invalid_schema) {
   EXPECT_EQ(errList.begin()->m_col, 12);
 }
 
+TEST_F(YmlSchemaChkTests, Compiled_schema_reused_until_modified) {
+  const string schemaDir = testoutput_folder + "/CompiledSchema";
+  const string datafile = testinput_folder + "/sample-data/clayer.yaml";
+  const string schemafile = schemaDir + "/clayer.schema.json";
+  RteFsUtils::CreateDirectories(schemaDir);
+  for (const auto& schema : { "clayer.schema.json", "csettings.schema.json" }) {
+    fs::copy_file(testinput_folder + "/" + schema, schemaDir + "/" + schema, fs::copy_options::overwrite_existing);
+  }
+
+  // compiled schema is reused and gives the same errors
+  YmlSchemaChecker ymlSchemaChecker;
+  EXPECT_FALSE(ymlSchemaChecker.ValidateFile(datafile, schemafile));
+  const list<RteError> errList = ymlSchemaChecker.GetErrors();
+  ASSERT_EQ(errList.size(), 4);
+  ymlSchemaChecker.ClearErrors();
+  EXPECT_FALSE(ymlSchemaChecker.ValidateFile(datafile, schemafile));
+  ASSERT_EQ(ymlSchemaChecker.GetErrors().size(), errList.size());
+  auto errItr = ymlSchemaChecker.GetErrors().begin();
+  for (const auto& err : errList) {
+    EXPECT_EQ(err.m_line, errItr->m_line);
+    EXPECT_EQ(err.m_col, errItr->m_col);
+    EXPECT_EQ(err.m_msg, errItr->m_msg);
+    errItr++;
+  }
+
+  // modified schema is compiled again
+  const auto time = fs::last_write_time(schemafile);
+  fs::copy_file(testinput_folder + "/invalid-schema.json", schemafile, fs::copy_options::overwrite_existing);
+  fs::last_write_time(schemafile, time + std::chrono::seconds(1));
+  ymlSchemaChecker.ClearErrors();
+  EXPECT_FALSE(ymlSchemaChecker.ValidateFile(datafile, schemafile));
+  ASSERT_EQ(ymlSchemaChecker.GetErrors().size(), 1);
+  EXPECT_EQ(ymlSchemaChecker.GetErrors().begin()->m_file, schemafile);
+}
+
 TEST_F(YmlSchemaChkTests, Invalid_yml_file) {
   string datafile = testinput_folder + "/sample-data/invalid.yaml";
   string schemafile = testinput_folder + "/clayer.schema.json";
@@ -394,17 +394,16 @@ bool BuildSystemGenerator::GenAuditFile(void) {
 }
 
 void BuildSystemGenerator::MergeVecStr(const std::vector<std::string>& src, std::vector<std::string>& dest) {
-  for (const auto& item : src)
-  {
-    CollectionUtils::PushBackUniquely(dest, item);
-  }
+  CollectionUtils::AddStringItemsUniquely(dest, src);
 }
 
 void BuildSystemGenerator::MergeVecStrNorm(const std::vector<std::string>& src, std::vector<std::string>& dest) {
+  std::vector<std::string> normalized;
   for (const auto& item : src)
   {
-    CollectionUtils::PushBackUniquely(dest, StrNorm(item));
+    normalized.push_back(StrNorm(item));
   }
+  CollectionUtils::AddStringItemsUniquely(dest, normalized);
 }
 
 string BuildSystemGenerator::StrNorm(string path) {
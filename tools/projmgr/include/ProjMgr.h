@@ -11,6 +11,7 @@
 #include "ProjMgrWorker.h"
 #include "ProjMgrGenerator.h"
 #include "ProjMgrYamlEmitter.h"
+#include "ProjMgrFingerprint.h"
 #include "ProjMgrRunDebug.h"
 #include "ProjMgrMlops.h"
 #include "ProjMgrRpcServer.h"
@@ -194,6 +195,7 @@ protected:
   ProjMgrYamlEmitter m_emitter;
   ProjMgrRunDebug m_runDebug;
   ProjMgrMlops m_mlops;
+  ProjMgrFingerprint m_fingerprint;
   ProjMgrRpcServer m_rpcServer;
 
   std::string m_csolutionFile;
@@ -222,6 +224,7 @@ protected:
   bool m_relativePaths;
   bool m_frozenPacks;
   bool m_cbuildgen;
+  bool m_incremental;
   bool m_updateIdx;
   bool m_rpcMode = false;
   bool m_locked;
@@ -258,6 +261,8 @@ protected:
   bool UpdateRte();
   bool ParseAndValidateContexts();
   bool ProcessContexts();
+  bool IsIncremental(const std::vector<ContextItem*>& contexts);
+  void SaveFingerprints(bool success);
   bool IsSolutionImageOnly();
   void InitSolution(const std::string& csolution, const std::string& activeTargetSet, const bool& updateRte);
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -29,7 +29,7 @@ public:
    * @return list of all error messages
   */
   const std::list<std::string>& GetErrorMessages() const {
-    return m_errorMessages;
+    return Current()->m_errorMessages;
   }
 
   /**
@@ -37,7 +37,7 @@ public:
    * @return list of all warning messages
   */
   const std::list<std::string>& GetWarningMessages() const {
-    return m_warningMessages;
+    return Current()->m_warningMessages;
   }
 
   /**
@@ -45,28 +45,28 @@ public:
    * @return list of all info messages
   */
   const std::list<std::string>& GetInfoMessages() const {
-    return m_infoMessages;
+    return Current()->m_infoMessages;
   }
 
   /**
    * @brief clear all error messages
   */
   void ClearErrorMessages() {
-    m_errorMessages.clear();
+    Current()->m_errorMessages.clear();
   }
 
   /**
    * @brief clear all warning messages
   */
   void ClearWarningMessages() {
-    m_warningMessages.clear();
+    Current()->m_warningMessages.clear();
   }
 
   /**
    * @brief clear all info messages
   */
   void ClearInfoMessages() {
-    m_infoMessages.clear();
+    Current()->m_infoMessages.clear();
   }
 
   /**
@@ -100,10 +100,49 @@ public:
   */
   void Err(const std::string& id, const std::string& message, const std::string& object = RteUtils::EMPTY_STRING) override;
 
+  /**
+   * @brief expand command or file using key sequences "@L", "%L", etc.
+   *        uses the project set for the calling thread if any, otherwise the active one
+   * @param str string to expand
+   * @return expanded string
+  */
+  std::string ExpandString(const std::string& str) override;
+  using RteCallback::ExpandString;
+
+  /**
+   * @brief report progress after the specified pack is parsed
+   * @param pack specified pack
+   * @param success flag indicating parsing result
+   * @return 0 to stop further processing if cancellation was requested, 1 to continue
+  */
+  int PackProcessed(const std::string& pack, bool success) override;
+
+  /**
+   * @brief redirect messages of the calling thread to another callback object
+   * @param callback pointer to ProjMgrCallback collecting the messages, nullptr to stop redirecting
+  */
+  static void SetThreadCallback(ProjMgrCallback* callback);
+
+  /**
+   * @brief set project used to expand strings instead of the active one
+   * @param project pointer to RteProject, nullptr to use the active project
+  */
+  void SetProject(RteProject* project) {
+    m_project = project;
+  }
+
+  /**
+   * @brief append messages collected by another callback object and clear them there
+   * @param callback ProjMgrCallback to take messages from
+  */
+  void Merge(ProjMgrCallback& callback);
+
 protected:
+  ProjMgrCallback* Current() const;
+
   std::list<std::string> m_errorMessages;
   std::list<std::string> m_warningMessages;
   std::list<std::string> m_infoMessages;
-
+  RteProject* m_project;
 };
 #endif // PROJMGRCALLBACK_H
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PROJMGRFINGERPRINT_H
+#define PROJMGRFINGERPRINT_H
+
+#include "ProjMgrWorker.h"
+
+/**
+ * @brief projmgr fingerprint class
+ *        records the input and output files of a converted context,
+ *        a context whose fingerprint still matches is skipped by the next incremental conversion
+*/
+class ProjMgrFingerprint {
+public:
+  /**
+   * @brief class constructor
+  */
+  ProjMgrFingerprint(void);
+
+  /**
+   * @brief class destructor
+  */
+  ~ProjMgrFingerprint(void);
+
+  /**
+   * @brief set settings shared by all contexts, e.g. command line options and environment
+   * @param keys list of settings
+  */
+  void SetEnvironment(const StrVec& keys);
+
+  /**
+   * @brief check whether a context is unchanged since its fingerprint was saved,
+   *        if so restore the context data needed by solution level files and replay its warnings
+   * @param context reference to context item
+   * @return true if the context is up to date
+  */
+  bool Restore(ContextItem& context);
+
+  /**
+   * @brief save fingerprint of a converted context
+   * @param context reference to context item
+   * @param contexts list of all contexts
+   * @param cbuildgen true if legacy cprj files are generated
+   * @return true if executed successfully
+  */
+  bool Save(const ContextItem& context, const std::vector<ContextItem*>& contexts, bool cbuildgen);
+
+  /**
+   * @brief remove fingerprint of a context
+   * @param context reference to context item
+  */
+  void Remove(const ContextItem& context);
+
+  /**
+   * @brief write the index of fingerprint files updated by Save and Remove
+   * @return true if executed successfully
+  */
+  bool SaveIndex(void);
+
+  /**
+   * @brief get fingerprint filename
+   * @param context reference to processed context item
+   * @return fingerprint filename in the directory of the context's cbuild.yml
+  */
+  static std::string GetFilename(const ContextItem& context);
+
+  /**
+   * @brief get filename of the fingerprint index
+   * @param context reference to context item
+   * @return index filename in the tmp directory, it maps context names to fingerprint filenames
+  */
+  static std::string GetIndexFilename(const ContextItem& context);
+
+protected:
+  std::string m_environment;
+  std::string m_indexFile;
+  std::map<std::string, std::string> m_index;
+
+  void LoadIndex(const ContextItem& context);
+  static std::string GetFileHash(const std::string& file);
+  static std::string GetFileTime(const std::string& file);
+  static std::vector<ResolvedPackItem> GetResolvedPacks(const std::vector<ResolvedPackItem>& resolvedPacks,
+    const StrSet& packs, const StrSet& selectedBy, bool ownPacksOnly);
+  static std::string GetResolvedPacksHash(const std::vector<ResolvedPackItem>& resolvedPacks);
+};
+
+#endif  // PROJMGRFINGERPRINT_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -142,13 +142,44 @@ public:
   */
   const std::ostringstream& GetStringStream() const { return m_ss; }
 
+  /**
+   * @brief redirect messages of the calling thread to a buffer, Get() returns the buffer in this thread
+   *        buffered messages are collected but not printed until they are replayed
+   * @param buffer pointer to ProjMgrLogger used as buffer, nullptr to stop redirecting
+  */
+  static void SetThreadBuffer(ProjMgrLogger* buffer);
+
+  /**
+   * @brief get buffer the messages of the calling thread are redirected to
+   * @return pointer to ProjMgrLogger used as buffer, nullptr if messages are not redirected
+  */
+  static ProjMgrLogger* GetThreadBuffer(void);
+
+  /**
+   * @brief report messages collected in a buffer in the order they were sent and clear the buffer
+   * @param buffer ProjMgrLogger used as buffer
+  */
+  void Replay(ProjMgrLogger& buffer);
+
 protected:
+  enum class Level { Error, Warn, Info, Debug };
+  struct BufferedMessage {
+    Level level;
+    std::string msg;
+    std::string context;
+    std::string file;
+    int line;
+    int column;
+  };
+
   std::map<std::string, std::vector<std::string>> m_errors;
   std::map<std::string, std::vector<std::string>> m_warns;
   std::map<std::string, std::vector<std::string>> m_infos;
 
   std::ostringstream m_ss; // stream for unsorted messages sent directly to output
 
+  bool m_isBuffer; // messages are buffered instead of printed
+  std::vector<BufferedMessage> m_buffer; // buffered messages in the order they were sent
 };
 
 #endif  // PROJMGRLOGGER_H
@@ -853,6 +853,15 @@ public:
   */
   bool ParseGenericClayer(const std::string& input, bool checkSchema);
 
+  /**
+   * @brief parse generic clayer files concurrently,
+   *        parsed files are kept for the process lifetime and reused while unchanged
+   * @param checkSchema false to skip schema validation
+   * @param inputs list of clayer.yml files, messages are reported in this order
+   * @return true if all files were parsed successfully
+  */
+  bool ParseGenericClayers(const std::vector<std::string>& inputs, bool checkSchema);
+
   /**
    * @brief parse cbuild set file
    * @param checkSchema false to skip schema validation
@@ -867,6 +876,19 @@ public:
   */
   bool ParseDebugAdapters(const std::string& input, bool checkSchema);
 
+  /**
+   * @brief invalidate cached items parsed from a file,
+   *        parsed cdefault, csolution, cproject and clayer items are kept for the process lifetime
+   *        and reused while their files keep size, modification time or content hash
+   * @param file path to file
+  */
+  static void InvalidateCache(const std::string& file);
+
+  /**
+   * @brief invalidate all cached items
+  */
+  static void ClearCache(void);
+
   /**
    * @brief get cdefault
    * @return cdefault item
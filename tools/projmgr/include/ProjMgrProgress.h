@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PROJMGRPROGRESS_H
+#define PROJMGRPROGRESS_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+
+/**
+ * @brief projmgr progress class
+ *        reports the progress of long running operations, e.g. pack loading and context processing,
+ *        to a receiver set by the rpc server, reports are throttled to a maximum rate,
+ *        operations check the cancellation flag between their steps
+*/
+class ProjMgrProgress {
+public:
+  /**
+   * @brief progress receiver
+   * @param message describing the current step
+   * @param percentage of the current phase
+  */
+  typedef std::function<void(const std::string& message, unsigned int percentage)> Receiver;
+
+  /**
+   * @brief class constructor
+  */
+  ProjMgrProgress(void);
+
+  /**
+   * @brief class destructor
+  */
+  ~ProjMgrProgress(void);
+
+  /**
+   * @brief get progress instance
+   * @return progress reference
+  */
+  static ProjMgrProgress& Get();
+
+  /**
+   * @brief set progress receiver
+   * @param receiver function receiving the reports, nullptr to stop reporting
+  */
+  void SetReceiver(const Receiver& receiver);
+
+  /**
+   * @brief set maximum report rate
+   * @param rate maximum number of reports per second, 0 for no limit
+  */
+  void SetRate(unsigned int rate);
+
+  /**
+   * @brief start a new phase, always reported
+   * @param title of the phase
+   * @param total number of steps in the phase
+  */
+  void Start(const std::string& title, size_t total);
+
+  /**
+   * @brief advance the current phase by one step, the last step is always reported
+   * @param item processed in this step
+  */
+  void Step(const std::string& item);
+
+  /**
+   * @brief set or reset cancellation of the running operation, may be called concurrently
+   * @param cancelled true to request cancellation
+  */
+  void SetCancelled(bool cancelled) { m_cancelled = cancelled; }
+
+  /**
+   * @brief check whether the running operation should stop
+   * @return true if cancellation was requested
+  */
+  bool IsCancelled(void) const { return m_cancelled; }
+
+protected:
+  std::mutex m_mutex;
+  Receiver m_receiver;
+  std::chrono::steady_clock::duration m_interval;
+  std::chrono::steady_clock::time_point m_last;
+  std::string m_title;
+  size_t m_total;
+  size_t m_done;
+  std::atomic<bool> m_cancelled;
+};
+
+#endif  // PROJMGRPROGRESS_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Arm Limited. All rights reserved.
+ * Copyright (c) 2025-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -7,7 +7,11 @@
 #ifndef PROJMGRRPCSERVER_H
 #define PROJMGRRPCSERVER_H
 
+#include "ProjMgrRpcTransport.h"
+
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <string>
 
 /**
@@ -68,11 +72,28 @@ public:
   */
   const std::string GetRequestFromStdin(void);
 
+  /**
+   * @brief send response to stdout, may be called concurrently
+   * @param request string request, logged together with the response in debug mode
+   * @param response string response
+  */
+  void SendResponse(const std::string& request, const std::string& response);
+
+  /**
+   * @brief send notification to stdout, may be called concurrently
+   * @param notification string notification
+  */
+  void SendNotification(const std::string& notification);
+
 protected:
   ProjMgr& m_manager;
   bool m_debug = false;
-  bool m_shutdown = false;
+  std::atomic<bool> m_shutdown = false;
   bool m_contextLength = false;
+  std::mutex m_responseMutex;
+  ProjMgrRpcTransport m_transport;
+
+  void Send(const std::string& message);
 };
 
 #endif  // PROJMGRRPCSERVER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Arm Limited. All rights reserved.
+ * Copyright (c) 2025-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -10,12 +10,41 @@
 
 #include <optional>
 #include <list>
+#include <map>
 #include <set>
 
 using namespace std;
 
 using PackReferenceVector = std::vector<RpcArgs::PackReference>;
 
+namespace RpcArgs {
+  // parameters and result of GetComponentsTreeView, defined like the types of the csolution-rpc interface
+  struct CtView {
+    optional<size_t> revision;     // revision known to the client, changed classes are returned if possible
+    optional<vector<string>> path; // class, bundle and group names of the subtree to return
+    optional<int> depth;           // number of levels to return below path
+  };
+  struct CtTreeView : SuccessResult {
+    size_t revision = 0;
+    bool delta = false;            // true if classes contains only classes changed since the requested revision
+    vector<CtClass> classes;
+    optional<vector<vector<string>>> collapsed; // paths of nodes whose children are not returned
+  };
+  void to_json(json& j, const CtView& v);
+  void from_json(const json& j, CtView& v);
+  void to_json(json& j, const CtTreeView& v);
+  void from_json(const json& j, CtTreeView& v);
+
+  // result of ValidateComponentsDelta
+  struct ResultsDelta : Results {
+    size_t revision = 0;
+    bool delta = false;                // true if validation contains only results with changed ids
+    optional<vector<string>> changed;  // ids whose previous results are replaced by validation
+  };
+  void to_json(json& j, const ResultsDelta& v);
+  void from_json(const json& j, ResultsDelta& v);
+}
+
 class RteTarget;
 class RteBundle;
 class RteComponent;
@@ -34,6 +63,9 @@ public:
   RteTarget* GetTarget() const { return m_target; }
 
   void CollectCtClasses(RpcArgs::CtRoot& ctRoot) const;
+  void CollectCtSubtree(vector<RpcArgs::CtClass>& classes, const std::set<std::string>* classNames,
+    const vector<string>& path, int depth, vector<vector<string>>& collapsed) const; // all classes if classNames is nullptr
+  bool HasCtNode(const vector<string>& path) const;
   void CollectUsedComponents(vector< RpcArgs::ComponentInstance>& usedComponents) const;
 
   std::set<std::string> GetUsedPacks() const;
@@ -55,9 +87,21 @@ public:
   std::string ResultStringFromRteItem(const RteItem* item) const;
 
 protected:
+  // part of the components tree to collect, nodes are addressed by class, bundle and group names
+  struct CtScope {
+    const vector<string>& path;          // path of the subtree
+    int depth;                           // levels below path to collect, negative for all levels
+    vector<vector<string>>& collapsed;   // nodes at the depth limit, their children are not collected
+    vector<string> current;              // path of the node being collected
+    bool Follows(const string& name) const { return current.size() >= path.size() || path[current.size()] == name; }
+    bool IsAncestor() const { return current.size() < path.size(); }
+    bool IsCollapsed() const { return depth >= 0 && current.size() >= path.size() + (size_t)depth; }
+  };
+
   void CollectBoardDevices(vector<RpcArgs::Device>& boardDevices, RteBoard* rteBoard, bool bMounted, std::list<RteDevice*>& processedDevices) const;
-  void CollectCtBundles(RpcArgs::CtClass& ctClass, RteComponentGroup* rteClass) const;
-  void CollectCtChildren(RpcArgs::CtTreeItem& parent, RteComponentGroup* rteGroup, const string& bundleName) const;
+  void CollectCtClasses(vector<RpcArgs::CtClass>& classes, const std::set<std::string>* classNames, CtScope* scope) const;
+  void CollectCtBundles(RpcArgs::CtClass& ctClass, RteComponentGroup* rteClass, CtScope* scope = nullptr) const;
+  void CollectCtChildren(RpcArgs::CtTreeItem& parent, RteComponentGroup* rteGroup, const string& bundleName, CtScope* scope = nullptr) const;
   void CollectCtAggregates(RpcArgs::CtTreeItem& parent, RteComponentGroup* rteGroup, const string& bundleName) const;
   void CollectCtVariants(RpcArgs::CtAggregate& ctAggregate, RteComponentAggregate* rteAggregate) const;
 
@@ -66,4 +110,49 @@ private:
   RteModel* m_model;   // RTE model for global data
 };
 
+/**
+ * @brief revisions of the components tree of a context, counted per component class.
+ * Revisions are bumped by selection and filter changes of the RTE model, not by comparing collected trees.
+*/
+class RpcComponentsTree {
+public:
+  /**
+   * @brief get current revision
+   * @return revision of the last change, 0 if not yet invalidated
+  */
+  size_t GetRevision() const { return m_revision; }
+
+  /**
+   * @brief mark all classes as changed, e.g. after a filter change
+   * @param revision new revision
+  */
+  void Invalidate(size_t revision);
+
+  /**
+   * @brief mark classes as changed, e.g. after a selection change
+   * @param revision new revision
+   * @param classNames names of changed classes
+  */
+  void Invalidate(size_t revision, const std::set<std::string>& classNames);
+
+  /**
+   * @brief check if changes since given revision are known per class
+   * @param revision revision known to the client
+   * @return true if revision is valid and not older than the last invalidation of all classes
+  */
+  bool HasChanges(size_t revision) const;
+
+  /**
+   * @brief collect names of classes changed after given revision
+   * @param revision revision known to the client
+   * @return set of class names
+  */
+  std::set<std::string> GetChangedClasses(size_t revision) const;
+
+protected:
+  size_t m_revision = 0;
+  size_t m_invalidated = 0; // revision all classes were changed in
+  std::map<std::string, size_t> m_classRevisions;
+};
+
 #endif // PROJMGRRPCSERVERDATA_
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PROJMGRRPCTRANSPORT_H
+#define PROJMGRRPCTRANSPORT_H
+
+#include <streambuf>
+#include <string>
+#include <vector>
+
+/**
+ * @brief projmgr rpc transport
+ *        frames json rpc messages read from stdin in large blocks and writes each message to stdout at once,
+ *        the standard file descriptors are used directly unless std::cin or std::cout are redirected
+*/
+class ProjMgrRpcTransport {
+public:
+  /**
+   * @brief class constructor
+  */
+  ProjMgrRpcTransport(void);
+
+  /**
+   * @brief class destructor
+  */
+  ~ProjMgrRpcTransport(void);
+
+  /**
+   * @brief read message preceded by 'Content-Length' header
+   * @return string message, empty at end of input
+  */
+  std::string ReadMessageWithLength(void);
+
+  /**
+   * @brief read message delimited by its outer braces
+   * @return string message, empty at end of input
+  */
+  std::string ReadMessage(void);
+
+  /**
+   * @brief check whether the input is exhausted
+   * @return true if end of input is reached and all buffered data is consumed
+  */
+  bool IsEnd(void);
+
+  /**
+   * @brief write message
+   * @param message string message
+   * @param contentLength prepend 'Content-Length' header if true, otherwise append new line
+  */
+  void WriteMessage(const std::string& message, bool contentLength);
+
+protected:
+  std::vector<char> m_buffer;
+  size_t m_begin;
+  size_t m_end;
+  bool m_eof;
+  std::streambuf* m_input;
+
+  void CheckInput(void);
+  bool Fill(void);
+};
+
+#endif  // PROJMGRRPCTRANSPORT_H
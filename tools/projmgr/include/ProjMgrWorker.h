@@ -63,6 +63,22 @@ struct ConnectionsList {
   StrPairPtrVec provides;
 };
 
+/**
+ * @brief connections combinations search
+ *        columns of classified connections,
+ *        keys provided by the columns from a given index onwards,
+ *        keys consumed by the columns from a given index onwards,
+ *        flag to skip partial combinations that cannot become valid,
+ *        visitor called for each complete combination,
+*/
+struct ConnectionsSearch {
+  std::vector<const ConnectionsCollectionVec*> columns;
+  std::vector<StrSet> remainingProvides;
+  std::vector<StrSet> remainingConsumes;
+  bool prune;
+  std::function<void(const ConnectionsCollectionVec&)> visit;
+};
+
 /**
  * @brief Environment list
  *        cmsis_pack_root,
@@ -495,6 +511,8 @@ struct VariablesConfiguration {
  *        vector of dependent contexts
  *        map of layers descriptors from packs
  *        flag indicating the context needs a rebuild
+ *        flag indicating the context is unchanged since its last conversion
+ *        cbuild-pack entries of an unchanged context
  *        vector of device books
  *        vector of board books
  *        additional memory
@@ -571,6 +589,8 @@ struct ContextItem {
   StrVec dependsOn;
   std::map<std::string, RteItem*> packLayers;
   bool needRebuild = false;
+  bool upToDate = false;
+  std::vector<ResolvedPackItem> resolvedPacks;
   std::vector<BookItem> deviceBooks;
   std::vector<BookItem> boardBooks;
   std::vector<MemoryItem> memory;
@@ -659,6 +679,19 @@ public:
   */
   bool ProcessContext(ContextItem& context, bool loadGenFiles = true, bool resolveDependencies = true, bool updateRteFiles = true);
 
+  /**
+   * @brief process contexts, target specific steps of different contexts run in parallel according to jobs setting
+   *        messages and results are reported in the given order as if the contexts were processed one by one,
+   *        once cancellation is requested via ProjMgrProgress the remaining contexts fail without being processed
+   * @param contexts vector of context pointers in processing order
+   * @param loadGenFiles boolean automatically load generated files
+   * @param resolveDependencies boolean automatically resolve dependencies
+   * @param updateRteFiles boolean update RTE files
+   * @param processed function called for each context after its messages are reported, receives result of ProcessContext
+  */
+  void ProcessContexts(const std::vector<ContextItem*>& contexts, bool loadGenFiles, bool resolveDependencies, bool updateRteFiles,
+    const std::function<void(ContextItem&, bool)>& processed);
+
   /**
    * @brief list available packs
    * @param reference to list of packs
@@ -813,6 +846,14 @@ public:
   */
   void GetExecutes(std::map<std::string, ExecutesItem>& executes);
 
+  /**
+   * @brief get environment settings shared by all contexts:
+   *        pack and compiler roots, registered toolchains, toolchain configuration files and installed packs
+   * @param reference to list of settings
+   * @return true if executed successfully
+  */
+  bool GetEnvironmentKeys(StrVec& keys);
+
   /**
    * @brief set output directory
    * @param reference to output directory
@@ -866,6 +907,24 @@ public:
   */
   void SetCbuild2Cmake(bool cbuild2cmake);
 
+  /**
+   * @brief set number of contexts and pdsc files processed in parallel
+   * @param jobs number of parallel jobs, 0 for number of hardware threads, default 1
+  */
+  void SetJobs(unsigned int jobs);
+
+  /**
+   * @brief enable cache of parsed pdsc files and index of installed packs in CMSIS_PACK_ROOT/.Local
+   * @param packCache true to enable, default false
+  */
+  void SetPackCache(bool packCache);
+
+  /**
+   * @brief get number of contexts processed in parallel
+   * @return number of parallel jobs, 0 for number of hardware threads
+  */
+  unsigned int GetJobs(void) const;
+
   /**
    * @brief set printing paths relative to project or ${CMSSIS_PACK_ROOT}
    * @param boolean bRelativePaths
@@ -1283,6 +1342,8 @@ protected:
   bool m_relativePaths;
   bool m_cbuild2cmake;
   bool m_isSetupCommand;
+  unsigned int m_jobs = 1;
+  bool m_packCache = false;
   bool m_rpcMode = false;
   std::set<std::string> m_undefLayerVars;
   StrMap m_packMetadata;
@@ -1358,6 +1419,10 @@ protected:
   ConnectionsValidationResult ValidateConnections(ConnectionsCollectionVec combination);
   void GetAllCombinations(const ConnectionsCollectionMap& src, const ConnectionsCollectionMap::iterator& it,
     std::vector<ConnectionsCollectionVec>& combinations, const ConnectionsCollectionVec& previous = ConnectionsCollectionVec());
+  void VisitCombinations(const ConnectionsCollectionMap& src, bool prune,
+    const std::function<void(const ConnectionsCollectionVec&)>& visit);
+  void SearchCombinations(const ConnectionsSearch& search, size_t index, ConnectionsCollectionVec& combination);
+  bool IsCombinationDiscarded(const ConnectionsCollectionVec& combination, const StrSet& remainingProvides, const StrSet& remainingConsumes);
   void GetAllSelectCombinations(const ConnectPtrMap& src, const ConnectPtrMap::iterator& it,
     std::vector<ConnectPtrVec>& combinations, const ConnectPtrVec& previous = ConnectPtrVec());
   void PushBackUniquely(ConnectionsCollectionVec& vec, const ConnectionsCollection& value);
@@ -1383,6 +1448,10 @@ protected:
   void InsertPackRequirements(const std::vector<PackItem>& src, std::vector<PackItem>& dst, std::string base);
   void CheckTypeFilterSpelling(const TypeFilter& typeFilter);
   void CheckCompilerFilterSpelling(const std::string& compiler);
+  void UpdateSharedState(const std::function<void()>& update);
+  bool ProcessContextPrecedences(ContextItem& context, bool updateRteFiles, bool& ret);
+  bool ProcessContextTarget(ContextItem& context, bool& ret);
+  void ProcessContextOutputs(ContextItem& context, bool loadGenFiles, bool resolveDependencies, bool& ret);
   bool ProcessGeneratedLayers(ContextItem& context);
   void CheckDeviceAttributes(const ContextItem& context, const ProcessorItem& userSelection, const StrMap& targetAttributes);
   std::string GetContextRteFolder(ContextItem& context);
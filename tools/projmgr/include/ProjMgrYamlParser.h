@@ -124,6 +124,8 @@ static constexpr const char* YAML_ETIME = "etime";
 static constexpr const char* YAML_FILE = "file";
 static constexpr const char* YAML_FILES = "files";
 static constexpr const char* YAML_FILL_VAL = "fill-val";
+static constexpr const char* YAML_FINGERPRINT = "fingerprint";
+static constexpr const char* YAML_FINGERPRINTS = "fingerprints";
 static constexpr const char* YAML_FLASH_INFO = "flash-info";
 static constexpr const char* YAML_FROM_PACK = "from-pack";
 static constexpr const char* YAML_FORBOARD = "for-board";
@@ -135,6 +137,7 @@ static constexpr const char* YAML_FPU = "fpu";
 static constexpr const char* YAML_GDBSERVER = "gdbserver";
 static constexpr const char* YAML_GENERATED_BY = "generated-by";
 static constexpr const char* YAML_HARDWARE = "hardware";
+static constexpr const char* YAML_HASH = "hash";
 static constexpr const char* YAML_GENERATOR = "generator";
 static constexpr const char* YAML_GENERATORS = "generators";
 static constexpr const char* YAML_GENERATOR_IMPORT = "generator-import";
@@ -273,6 +276,7 @@ static constexpr const char* YAML_TARGETTYPES = "target-types";
 static constexpr const char* YAML_TEMPLATE = "template";
 static constexpr const char* YAML_TELNET = "telnet";
 static constexpr const char* YAML_TRACE_SETUP = "trace-setup";
+static constexpr const char* YAML_TIME = "time";
 static constexpr const char* YAML_TIMEOUT = "timeout";
 static constexpr const char* YAML_TRUSTZONE = "trustzone";
 static constexpr const char* YAML_TITLE = "title";
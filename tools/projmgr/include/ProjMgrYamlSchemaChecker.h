@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -9,6 +9,9 @@
 
 #include "YmlSchemaChecker.h"
 
+#include <string>
+#include <vector>
+
 /**
   * @brief projmgr schema checker implementation class, directly coupled to underlying YamlSchemaChecker library
 */
@@ -28,6 +31,18 @@ public:
    * @return schema file name if found, empty string otherwise
   */
   std::string FindSchema(const std::string& file) const override;
+
+  /**
+   * @brief Validates files concurrently without reporting errors,
+   *        results are kept and reported by the next Validate() call of an unchanged file
+   * @param files list of files to validate
+  */
+  static void Prevalidate(const std::vector<std::string>& files);
+
+  /**
+   * @brief Discards prevalidation results not consumed by Validate()
+  */
+  static void ClearPrevalidation();
 };
 
 #endif  // PROJMGRYAMLSCHEMACHECKER_H
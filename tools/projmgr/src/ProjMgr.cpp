@@ -7,7 +7,9 @@
 #include "ProjMgr.h"
 #include "ProjMgrParser.h"
 #include "ProjMgrLogger.h"
+#include "ProjMgrProgress.h"
 #include "ProjMgrUtils.h"
+#include "ProjMgrYamlSchemaChecker.h"
 #include "ProductInfo.h"
 #include "RteFsUtils.h"
 
@@ -51,6 +53,7 @@ Options:\n\
   -e, --export arg              Set suffix for exporting <context><suffix>.cprj retaining only specified versions\n\
   -f, --filter arg [...]        Filter output by word or string; repeat the option for multiple filters\n\
   -g, --generator arg           Code generator identifier\n\
+  -j, --jobs arg                Number of contexts and pdsc files processed in parallel, 0 for all cores (default \"1\")\n\
   -l, --load arg                Set policy for packs loading [latest | all | required]\n\
   -L, --clayer-path arg         Set search path for external clayers\n\
   -m, --missing                 List only required packs that are missing in the pack repository\n\
@@ -83,6 +86,7 @@ ProjMgr::ProjMgr() :
   m_relativePaths(false),
   m_frozenPacks(false),
   m_cbuildgen(false),
+  m_incremental(false),
   m_updateIdx(false)
 {
   m_worker.SetEmitter(&m_emitter);
@@ -151,6 +155,7 @@ int ProjMgr::ParseCommandLine(int argc, char** argv) {
   cxxopts::Option filter("f,filter", "Filter output by word or string; repeat the option for multiple filters", cxxopts::value<vector<string>>());
   cxxopts::Option help("h,help", "Print usage");
   cxxopts::Option generator("g,generator", "Code generator identifier", cxxopts::value<string>());
+  cxxopts::Option jobs("j,jobs", "Number of contexts and pdsc files processed in parallel, 0 for all cores", cxxopts::value<unsigned int>()->default_value("1"));
   cxxopts::Option load("l,load", "Set policy for packs loading [latest | all | required]", cxxopts::value<string>());
   cxxopts::Option clayerSearchPath("L,clayer-path", "Set search path for external clayers", cxxopts::value<string>());
   cxxopts::Option missing("m,missing", "List only required packs that are missing in the pack repository", cxxopts::value<bool>()->default_value("false"));
@@ -171,44 +176,47 @@ int ProjMgr::ParseCommandLine(int argc, char** argv) {
   cxxopts::Option updateIdx("update-idx", "Update cbuild-idx file with layer info", cxxopts::value<bool>()->default_value("false"));
   cxxopts::Option quiet("q,quiet", "Run silently, printing only error messages", cxxopts::value<bool>()->default_value("false"));
   cxxopts::Option cbuildgen("cbuildgen", "Generate legacy *.cprj files", cxxopts::value<bool>()->default_value("false"));
+  cxxopts::Option incremental("incremental", "Skip contexts whose input files are unchanged since the last conversion", cxxopts::value<bool>()->default_value("false"));
   cxxopts::Option contentLength("content-length", "Prepend 'Content-Length' header to JSON RPC requests and responses", cxxopts::value<bool>()->default_value("false"));
+  cxxopts::Option progressRate("progress-rate", "Maximum number of JSON RPC progress notifications per second, 0 for no limit", cxxopts::value<unsigned int>()->default_value("10"));
   cxxopts::Option activeTargetSet("a,active", "Select active target-set: <target-type>[@<set>]", cxxopts::value<string>());
   cxxopts::Option locked("locked", "Print available update version for locked packs", cxxopts::value<bool>()->default_value("false"));
+  cxxopts::Option packCache("pack-cache", "Load unchanged pdsc files from a cache in CMSIS_PACK_ROOT/.Local", cxxopts::value<bool>()->default_value("false"));
 
   // command options dictionary
   map<string, std::pair<bool, vector<cxxopts::Option>>> optionsDict = {
     // command, optional args, options
-    {"update-rte",         { false, {context, contextSet, activeTargetSet, debug, load, quiet, schemaCheck, toolchain, verbose, frozenPacks}}},
-    {"convert",            { false, {context, contextSet, activeTargetSet, debug, exportSuffix, load, quiet, schemaCheck, noUpdateRte, output, outputAlt, toolchain, verbose, frozenPacks, cbuildgen}}},
-    {"run",                { false, {context, contextSet, activeTargetSet, debug, generator, load, quiet, schemaCheck, verbose, dryRun}}},
-    {"check pack-updates", { false, {context, contextSet, activeTargetSet, debug, load, quiet, schemaCheck, verbose}}},
-    {"list packs",         { true,  {context, contextSet, activeTargetSet, debug, filter, load, missing, locked, quiet, schemaCheck, toolchain, verbose}}},
-    {"list boards",        { true,  {context, contextSet, activeTargetSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list devices",       { true,  {context, contextSet, activeTargetSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list npus",          { true,  {context, contextSet, activeTargetSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list configs",       { false, {context, contextSet, activeTargetSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list components",    { true,  {context, contextSet, activeTargetSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list dependencies",  { false, {context, contextSet, activeTargetSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list examples",      { false, {context, contextSet, activeTargetSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list templates",     { false, {context, contextSet, activeTargetSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
+    {"update-rte",         { false, {context, contextSet, activeTargetSet, debug, jobs, load, packCache, quiet, schemaCheck, toolchain, verbose, frozenPacks}}},
+    {"convert",            { false, {context, contextSet, activeTargetSet, debug, exportSuffix, jobs, load, packCache, quiet, schemaCheck, noUpdateRte, output, outputAlt, toolchain, verbose, frozenPacks, cbuildgen, incremental}}},
+    {"run",                { false, {context, contextSet, activeTargetSet, debug, generator, load, packCache, quiet, schemaCheck, verbose, dryRun}}},
+    {"check pack-updates", { false, {context, contextSet, activeTargetSet, debug, load, packCache, quiet, schemaCheck, verbose}}},
+    {"list packs",         { true,  {context, contextSet, activeTargetSet, debug, filter, load, packCache, missing, locked, quiet, schemaCheck, toolchain, verbose}}},
+    {"list boards",        { true,  {context, contextSet, activeTargetSet, debug, filter, load, packCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list devices",       { true,  {context, contextSet, activeTargetSet, debug, filter, load, packCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list npus",          { true,  {context, contextSet, activeTargetSet, debug, filter, load, packCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list configs",       { false, {context, contextSet, activeTargetSet, debug, filter, load, packCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list components",    { true,  {context, contextSet, activeTargetSet, debug, filter, load, packCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list dependencies",  { false, {context, contextSet, activeTargetSet, debug, filter, load, packCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list examples",      { false, {context, contextSet, activeTargetSet, debug, filter, load, packCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list templates",     { false, {context, contextSet, activeTargetSet, debug, filter, load, packCache, quiet, schemaCheck, toolchain, verbose}}},
     {"list contexts",      { false, {debug, filter, quiet, schemaCheck, verbose, ymlOrder}}},
     {"list target-sets",   { false, {debug, filter, quiet, schemaCheck, verbose}}},
     {"list debuggers",     { false, {debug, filter, quiet, schemaCheck, verbose}}},
-    {"list generators",    { false, {context, contextSet, activeTargetSet, debug, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list layers",        { false, {context, contextSet, activeTargetSet, debug, load, clayerSearchPath, quiet, schemaCheck, toolchain, verbose, updateIdx}}},
+    {"list generators",    { false, {context, contextSet, activeTargetSet, debug, load, packCache, quiet, schemaCheck, toolchain, verbose}}},
+    {"list layers",        { false, {context, contextSet, activeTargetSet, debug, load, packCache, clayerSearchPath, quiet, schemaCheck, toolchain, verbose, updateIdx}}},
     {"list toolchains",    { false, {context, contextSet, activeTargetSet, debug, quiet, toolchain, verbose}}},
     {"list environment",   { true,  {}}},
-    {"rpc",                { true,  {contentLength}}},
+    {"rpc",                { true,  {contentLength, packCache, progressRate}}},
   };
 
   try {
     options.add_options("", {
       {"positional", "", cxxopts::value<vector<string>>()},
-      solution, context, contextSet, filter, generator,
+      solution, context, contextSet, filter, generator, jobs,
       load, clayerSearchPath, missing, schemaCheck, noUpdateRte, output, outputAlt,
       help, version, verbose, debug, dryRun, exportSuffix, toolchain, ymlOrder,
-      relativePaths, frozenPacks, updateIdx, quiet, cbuildgen, contentLength,
-      activeTargetSet, locked
+      relativePaths, frozenPacks, updateIdx, quiet, cbuildgen, incremental, contentLength,
+      progressRate, activeTargetSet, locked, packCache
     });
     options.parse_positional({ "positional" });
 
@@ -234,10 +242,14 @@ int ProjMgr::ParseCommandLine(int argc, char** argv) {
     m_frozenPacks = parseResult.count("frozen-packs");
     m_cbuildgen = parseResult.count("cbuildgen");
     m_worker.SetCbuild2Cmake(!m_cbuildgen);
+    m_incremental = parseResult.count("incremental");
+    m_worker.SetJobs(parseResult["jobs"].as<unsigned int>());
+    m_worker.SetPackCache(parseResult.count("pack-cache"));
     ProjMgrLogger::m_quiet = parseResult.count("quiet");
     ProjMgrLogger::m_verbose = m_verbose;
     m_rpcServer.SetContentLengthHeader(parseResult.count("content-length"));
     m_rpcServer.SetDebug(m_debug);
+    ProjMgrProgress::Get().SetRate(parseResult["progress-rate"].as<unsigned int>());
     m_locked = parseResult.count("locked");
 
     vector<string> positionalArguments;
@@ -519,6 +531,18 @@ bool ProjMgr::PopulateContexts(void) {
         ProjMgrLogger::Get().Warn("cproject.yml files should be placed in separate sub-directories", "", m_csolutionFile);
       }
     }
+    // Validate cprojects schemas concurrently ahead of parsing
+    if (m_checkSchema) {
+      StrVec cprojectFiles;
+      for (const auto& cproject : cprojects) {
+        error_code ec;
+        const string& cprojectFile = fs::canonical(m_rootDir + "/" + cproject, ec).generic_string();
+        if (!cprojectFile.empty()) {
+          cprojectFiles.push_back(cprojectFile);
+        }
+      }
+      ProjMgrYamlSchemaChecker::Prevalidate(cprojectFiles);
+    }
     // Parse cprojects
     for (const auto& cproject : cprojects) {
       error_code ec;
@@ -531,6 +555,8 @@ bool ProjMgr::PopulateContexts(void) {
         result = false;
       }
     }
+    // Results of cprojects not parsed must not be reported by later checks
+    ProjMgrYamlSchemaChecker::ClearPrevalidation();
   } else {
     ProjMgrLogger::Get().Error("csolution file not specified");
     return false;
@@ -584,10 +610,18 @@ bool ProjMgr::GenerateYMLConfigurationFiles(bool previousResult) {
   bool result = UpdateRte();
 
   // Generate cbuild files
+  ProjMgrProgress::Get().Start("generating cbuild files", count_if(m_processedContexts.begin(), m_processedContexts.end(),
+    [](const ContextItem* c) { return !c->upToDate; }));
   for (auto& contextItem : m_processedContexts) {
+    if (contextItem->upToDate) {
+      ProjMgrLogger::Get().Info("file is already up-to-date", contextItem->name,
+        contextItem->directories.cbuild + "/" + contextItem->name + ".cbuild.yml");
+      continue;
+    }
     if (!m_emitter.GenerateCbuild(contextItem)) {
       result = false;
     }
+    ProjMgrProgress::Get().Step(contextItem->name);
   }
 
   // Generate cbuild-run file
@@ -731,26 +765,86 @@ bool ProjMgr::ProcessContexts() {
   m_allContexts.clear();
   m_processedContexts.clear();
   m_failedContext.clear();
+  vector<ContextItem*> selectedContexts;
   for (auto& contextName : orderedContexts) {
     auto& contextItem = (*contexts)[contextName];
     m_allContexts.push_back(&contextItem);
-    if (!m_worker.IsContextSelected(contextName)) {
+    if (m_worker.IsContextSelected(contextName)) {
+      selectedContexts.push_back(&contextItem);
+    }
+  }
+  // Skip unchanged contexts
+  vector<ContextItem*> changedContexts;
+  const bool incremental = IsIncremental(selectedContexts);
+  for (auto& contextItem : selectedContexts) {
+    if (incremental && contextItem->cproject && !contextItem->imageOnly && !contextItem->westOn &&
+      m_fingerprint.Restore(*contextItem)) {
       continue;
     }
-    if (!m_worker.ProcessContext(contextItem, true, true, false)) {
-      ProjMgrLogger::Get().Error("processing context '" + contextName + "' failed", contextName);
+    changedContexts.push_back(contextItem);
+  }
+  ProjMgrProgress::Get().Start("processing contexts", changedContexts.size());
+  m_worker.ProcessContexts(changedContexts, true, true, false, [&](ContextItem& contextItem, bool processed) {
+    ProjMgrProgress::Get().Step(contextItem.name);
+    if (!processed) {
+      ProjMgrLogger::Get().Error("processing context '" + contextItem.name + "' failed", contextItem.name);
       m_failedContext.insert(contextItem.name);
       success = false;
     }
-    m_processedContexts.push_back(&contextItem);
-  }
+  });
+  m_processedContexts = selectedContexts;
   return success;
 }
 
+bool ProjMgr::IsIncremental(const vector<ContextItem*>& contexts) {
+  if (!m_incremental) {
+    return false;
+  }
+  // cbuild-run and executes nodes require all contexts to be processed
+  if (m_contextSet || m_activeTargetSet.has_value() || !m_parser.GetCsolution().executes.empty()) {
+    return false;
+  }
+  for (const auto& context : contexts) {
+    if (context->cproject && !context->cproject->executes.empty()) {
+      return false;
+    }
+  }
+  StrVec keys;
+  if (!m_worker.GetEnvironmentKeys(keys)) {
+    return false;
+  }
+  // options affecting the conversion
+  keys.push_back("output=" + m_outputDir);
+  keys.push_back("toolchain=" + m_selectedToolchain);
+  keys.push_back("load=" + m_loadPacksPolicy);
+  keys.push_back("export=" + m_export);
+  keys.push_back(string("update-rte=") + (m_updateRteFiles ? "1" : "0"));
+  keys.push_back(string("cbuildgen=") + (m_cbuildgen ? "1" : "0"));
+  keys.push_back(string("frozen-packs=") + (m_frozenPacks ? "1" : "0"));
+  m_fingerprint.SetEnvironment(keys);
+  return true;
+}
+
+void ProjMgr::SaveFingerprints(bool success) {
+  for (const auto& contextItem : m_processedContexts) {
+    if (contextItem->upToDate) {
+      continue;
+    }
+    if (success && contextItem->cproject && !contextItem->imageOnly && !contextItem->westOn &&
+      m_failedContext.find(contextItem->name) == m_failedContext.end() &&
+      ProjMgrLogger::Get().GetErrorsForContext(contextItem->name).empty()) {
+      m_fingerprint.Save(*contextItem, m_allContexts, m_cbuildgen);
+    } else {
+      m_fingerprint.Remove(*contextItem);
+    }
+  }
+  m_fingerprint.SaveIndex();
+}
+
 bool ProjMgr::UpdateRte() {
   // Update the RTE files
   for (auto& contextItem : m_processedContexts) {
-    if (contextItem->rteActiveProject != nullptr) {
+    if (contextItem->rteActiveProject != nullptr && !contextItem->upToDate) {
       if (m_updateRteFiles) {
         contextItem->rteActiveProject->SetAttribute("update-rte-files", "1");
         contextItem->rteActiveProject->UpdateRte();
@@ -764,7 +858,7 @@ bool ProjMgr::UpdateRte() {
 
   for (auto& contextItem : m_processedContexts) {
     // Check PLM files
-    if (!m_worker.CheckConfigPLMFiles(*contextItem)) {
+    if (!contextItem->upToDate && !m_worker.CheckConfigPLMFiles(*contextItem)) {
       m_failedContext.insert(contextItem->name);
       result = false;
     }
@@ -792,6 +886,9 @@ bool ProjMgr::RunConvert(const std::string& csolution, const std::string& active
   // Generate Cprjs
   if (m_cbuildgen) {
     for (auto& contextItem : m_processedContexts) {
+      if (contextItem->upToDate) {
+        continue;
+      }
       const string filename = RteFsUtils::MakePathCanonical(contextItem->directories.cprj + "/" + contextItem->name + ".cprj");
       RteFsUtils::CreateDirectories(contextItem->directories.cprj);
       if (m_generator.GenerateCprj(*contextItem, filename)) {
@@ -813,6 +910,11 @@ bool ProjMgr::RunConvert(const std::string& csolution, const std::string& active
     }
   }
 
+  // Save fingerprints of converted contexts
+  if (m_incremental) {
+    SaveFingerprints(Success);
+  }
+
   return Success;
 }
 
@@ -1,15 +1,20 @@
 /*
- * Copyright (c) 2020-2025 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include "ProjMgrCallback.h"
 #include "ProjMgrKernel.h"
+#include "ProjMgrProgress.h"
 
 using namespace std;
 
-ProjMgrCallback::ProjMgrCallback() : RteCallback()
+// callback collecting messages of the current thread
+static thread_local ProjMgrCallback* theThreadCallback = nullptr;
+
+ProjMgrCallback::ProjMgrCallback() : RteCallback(),
+  m_project(nullptr)
 {
 }
 
@@ -38,22 +43,58 @@ void ProjMgrCallback::Err(const string& id, const string& message, const string&
 void ProjMgrCallback::OutputErrMessage(const string& message)
 {
   if(!message.empty()) {
-    m_errorMessages.push_back(message);
+    Current()->m_errorMessages.push_back(message);
   }
 }
 
 void ProjMgrCallback::OutputMessage(const string& message)
 {
   if (!message.empty()) {
-    m_warningMessages.push_back(message);
+    Current()->m_warningMessages.push_back(message);
   }
 }
 
 void ProjMgrCallback::OutputInfoMessage(const string& message)
 {
   if (!message.empty()) {
-    m_infoMessages.push_back(message);
+    Current()->m_infoMessages.push_back(message);
+  }
+}
+
+ProjMgrCallback* ProjMgrCallback::Current() const
+{
+  if (theThreadCallback && theThreadCallback != this) {
+    return theThreadCallback;
+  }
+  return const_cast<ProjMgrCallback*>(this);
+}
+
+void ProjMgrCallback::SetThreadCallback(ProjMgrCallback* callback)
+{
+  theThreadCallback = callback;
+}
+
+string ProjMgrCallback::ExpandString(const string& str)
+{
+  RteProject* project = Current()->m_project;
+  if (project) {
+    return RteCallback::ExpandString(str, project);
   }
+  return RteCallback::ExpandString(str);
+}
+
+int ProjMgrCallback::PackProcessed(const string& pack, bool success)
+{
+  ProjMgrProgress::Get().Step(RteUtils::ExtractFileName(pack));
+  return ProjMgrProgress::Get().IsCancelled() ? 0 : 1;
+}
+
+void ProjMgrCallback::Merge(ProjMgrCallback& callback)
+{
+  ProjMgrCallback* current = Current();
+  current->m_errorMessages.splice(current->m_errorMessages.end(), callback.m_errorMessages);
+  current->m_warningMessages.splice(current->m_warningMessages.end(), callback.m_warningMessages);
+  current->m_infoMessages.splice(current->m_infoMessages.end(), callback.m_infoMessages);
 }
 
 // end of ProjMgrCallback.cpp
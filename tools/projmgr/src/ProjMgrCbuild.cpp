@@ -96,14 +96,12 @@ void ProjMgrCbuild::SetContextNode(YAML::Node contextNode, const ContextItem* co
   SetPacksNode(contextNode[YAML_PACKS], context);
   if (!context->imageOnly && !context->westOn) {
     SetControlsNode(contextNode, context, context->controls.processed);
-    vector<string> defines;
+    UniqueVector<string> defines;
     if (context->rteActiveTarget != nullptr) {
-      for (const auto& define : context->rteActiveTarget->GetDefines()) {
-        CollectionUtils::PushBackUniquely(defines, define);
-      }
+      defines.AddItems(context->rteActiveTarget->GetDefines());
     }
-    SetDefineNode(contextNode[YAML_DEFINE], defines);
-    SetDefineNode(contextNode[YAML_DEFINE_ASM], defines);
+    SetDefineNode(contextNode[YAML_DEFINE], defines.GetItems());
+    SetDefineNode(contextNode[YAML_DEFINE_ASM], defines.GetItems());
     if (context->rteActiveTarget != nullptr) {
       for (auto include : context->rteActiveTarget->GetIncludePaths(RteFile::Language::LANGUAGE_NONE)) {
         RteFsUtils::NormalizePath(include, context->cproject->directory);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -41,6 +41,21 @@ ProjMgrCbuildPack::ProjMgrCbuildPack(YAML::Node node, const vector<ContextItem*>
     }
   }
 
+  // Stage 1b: Add the cbuild pack entries of unchanged contexts, restored from their fingerprints
+  for (const auto& context : processedContexts) {
+    for (const auto& resolvedItem : context->resolvedPacks) {
+      if (model.find(resolvedItem.pack) == model.end()) {
+        ModelItem modelItem;
+        ProjMgrUtils::ConvertToPackInfo(resolvedItem.pack, modelItem.info);
+        modelItem.resolvedPack.pack = resolvedItem.pack;
+        model[resolvedItem.pack] = modelItem;
+      }
+      for (const auto& selectedBy : resolvedItem.selectedByPack) {
+        CollectionUtils::PushBackUniquely(model[resolvedItem.pack].resolvedPack.selectedByPack, selectedBy);
+      }
+    }
+  }
+
   // Stage 2: Process packs that are required by used components
   for (const auto& context : processedContexts) {
     for (const auto& [packId, package] : context->packages) {
@@ -97,6 +112,23 @@ ProjMgrCbuildPack::ProjMgrCbuildPack(YAML::Node node, const vector<ContextItem*>
     }
   }
 
+  // Stage 4b: Apply wildcard patterns of unchanged contexts to packs of other contexts
+  for (const auto& context : processedContexts) {
+    for (const auto& resolvedItem : context->resolvedPacks) {
+      for (const auto& selectedBy : resolvedItem.selectedByPack) {
+        PackInfo reqInfo;
+        ProjMgrUtils::ConvertToPackInfo(selectedBy, reqInfo);
+        if (reqInfo.name.empty() || WildCards::IsWildcardPattern(reqInfo.name)) {
+          for (auto& [_, item] : model) {
+            if (ProjMgrUtils::IsMatchingPackInfo(item.info, reqInfo)) {
+              CollectionUtils::PushBackUniquely(item.resolvedPack.selectedByPack, selectedBy);
+            }
+          }
+        }
+      }
+    }
+  }
+
   // Sort model before saving to ensure stable cbuild-pack.yml content
   vector<pair<string, ModelItem>> sortedModel;
   for (const auto& item : model) {
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ProductInfo.h"
+#include "ProjMgrFingerprint.h"
+#include "ProjMgrLogger.h"
+#include "ProjMgrYamlParser.h"
+#include "RteFsUtils.h"
+#include "RteModel.h"
+#include "RtePackCache.h"
+#include "RteProject.h"
+
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+ProjMgrFingerprint::ProjMgrFingerprint(void) {
+  // Reserved
+}
+
+ProjMgrFingerprint::~ProjMgrFingerprint(void) {
+  // Reserved
+}
+
+void ProjMgrFingerprint::SetEnvironment(const StrVec& keys) {
+  string buffer = ORIGINAL_FILENAME + string(" version ") + VERSION_STRING + '\n';
+  for (const auto& key : keys) {
+    buffer += key + '\n';
+  }
+  stringstream ss;
+  ss << hex << RtePackCache::CalcHash(buffer);
+  m_environment = ss.str();
+}
+
+string ProjMgrFingerprint::GetFilename(const ContextItem& context) {
+  // next to the context's cbuild.yml: contexts of different output directories do not share fingerprints
+  return context.directories.cprj + "/" + context.name + ".fingerprint.yml";
+}
+
+string ProjMgrFingerprint::GetIndexFilename(const ContextItem& context) {
+  // the cbuild.yml directory may contain access sequences that are only expanded by processing the context
+  return context.csolution->directories.tmpdir + "/" + context.csolution->name + ".fingerprints.yml";
+}
+
+void ProjMgrFingerprint::LoadIndex(const ContextItem& context) {
+  const string& indexFile = GetIndexFilename(context);
+  if (indexFile == m_indexFile) {
+    return;
+  }
+  m_indexFile = indexFile;
+  m_index.clear();
+  if (!RteFsUtils::Exists(m_indexFile)) {
+    return;
+  }
+  try {
+    const YAML::Node& rootNode = YAML::LoadFile(m_indexFile);
+    for (const auto& item : rootNode[YAML_FINGERPRINTS]) {
+      m_index[item[YAML_CONTEXT].as<string>("")] = item[YAML_FILE].as<string>("");
+    }
+  }
+  catch (YAML::Exception&) {
+    m_index.clear();
+  }
+}
+
+bool ProjMgrFingerprint::SaveIndex(void) {
+  if (m_indexFile.empty()) {
+    return true;
+  }
+  YAML::Node rootNode;
+  for (const auto& [context, file] : m_index) {
+    YAML::Node itemNode;
+    itemNode[YAML_CONTEXT] = context;
+    itemNode[YAML_FILE] = file;
+    rootNode[YAML_FINGERPRINTS].push_back(itemNode);
+  }
+  if (!RteFsUtils::MakeSureFilePath(m_indexFile)) {
+    return false;
+  }
+  ofstream fileStream(m_indexFile);
+  if (!fileStream) {
+    return false;
+  }
+  YAML::Emitter emitter;
+  emitter << rootNode;
+  fileStream << emitter.c_str() << endl;
+  return fileStream.good();
+}
+
+vector<ResolvedPackItem> ProjMgrFingerprint::GetResolvedPacks(const vector<ResolvedPackItem>& resolvedPacks,
+  const StrSet& packs, const StrSet& selectedBy, bool ownPacksOnly) {
+  // cbuild-pack entries of the context: its resolved packs and the packs selected by its requirements
+  vector<ResolvedPackItem> entries;
+  for (const auto& resolvedPack : resolvedPacks) {
+    ResolvedPackItem entry = { resolvedPack.pack, {} };
+    for (const auto& item : resolvedPack.selectedByPack) {
+      if (selectedBy.find(item) != selectedBy.end()) {
+        entry.selectedByPack.push_back(item);
+      }
+    }
+    if (packs.find(entry.pack) != packs.end() || (!ownPacksOnly && !entry.selectedByPack.empty())) {
+      sort(entry.selectedByPack.begin(), entry.selectedByPack.end());
+      entries.push_back(entry);
+    }
+  }
+  sort(entries.begin(), entries.end(), [](const ResolvedPackItem& item1, const ResolvedPackItem& item2) {
+    return item1.pack < item2.pack;
+  });
+  return entries;
+}
+
+string ProjMgrFingerprint::GetResolvedPacksHash(const vector<ResolvedPackItem>& resolvedPacks) {
+  string buffer;
+  for (const auto& resolvedPack : resolvedPacks) {
+    buffer += resolvedPack.pack + ':';
+    for (const auto& item : resolvedPack.selectedByPack) {
+      buffer += ' ' + item;
+    }
+    buffer += '\n';
+  }
+  stringstream ss;
+  ss << hex << RtePackCache::CalcHash(buffer);
+  return ss.str();
+}
+
+string ProjMgrFingerprint::GetFileHash(const string& file) {
+  string buffer;
+  if (!RteFsUtils::Exists(file) || !RteFsUtils::ReadFile(file, buffer)) {
+    return RteUtils::EMPTY_STRING;
+  }
+  stringstream ss;
+  ss << hex << RtePackCache::CalcHash(buffer);
+  return ss.str();
+}
+
+string ProjMgrFingerprint::GetFileTime(const string& file) {
+  if (!RteFsUtils::Exists(file)) {
+    return RteUtils::EMPTY_STRING;
+  }
+  return to_string(RteFsUtils::GetModificationTime(file).time_since_epoch().count());
+}
+
+bool ProjMgrFingerprint::Restore(ContextItem& context) {
+  if (m_environment.empty()) {
+    return false;
+  }
+  LoadIndex(context);
+  const auto it = m_index.find(context.name);
+  if (it == m_index.end() || !RteFsUtils::Exists(it->second)) {
+    return false;
+  }
+  const string& filename = it->second;
+  YAML::Node rootNode;
+  try {
+    rootNode = YAML::LoadFile(filename);
+  }
+  catch (YAML::Exception&) {
+    return false;
+  }
+  const YAML::Node& node = rootNode[YAML_FINGERPRINT];
+  if (!node.IsMap() || node[YAML_ENVIRONMENT].as<string>("") != m_environment) {
+    return false;
+  }
+
+  // layers must be the same, generated layers are only known after processing
+  StrVec clayers;
+  for (const auto& [clayer, _] : context.clayers) {
+    clayers.push_back(clayer);
+  }
+  if (node[YAML_CLAYERS].as<StrVec>(StrVec()) != clayers) {
+    return false;
+  }
+
+  // input and output files must be unchanged
+  for (const auto& key : { YAML_INPUT, YAML_OUTPUT }) {
+    for (const auto& item : node[key]) {
+      if (GetFileHash(item[YAML_FILE].as<string>("")) != item[YAML_HASH].as<string>("")) {
+        return false;
+      }
+    }
+  }
+  for (const auto& item : node[YAML_PACKS]) {
+    if (GetFileTime(item[YAML_PACK].as<string>("")) != item[YAML_TIME].as<string>("")) {
+      return false;
+    }
+  }
+
+  // cbuild-pack entries of the context must be unchanged, entries of other contexts are not relevant
+  const YAML::Node& cbuildPackNode = node[YAML_CBUILD_PACK];
+  vector<ResolvedPackItem> resolvedPacks;
+  StrSet packs;
+  for (const auto& item : cbuildPackNode[YAML_RESOLVED_PACKS]) {
+    resolvedPacks.push_back({ item[YAML_RESOLVED_PACK].as<string>(""), item[YAML_SELECTED_BY_PACK].as<StrVec>(StrVec()) });
+    packs.insert(resolvedPacks.back().pack);
+  }
+  const StrVec& selectedBy = cbuildPackNode[YAML_SELECTED_BY_PACK].as<StrVec>(StrVec());
+  if (GetResolvedPacksHash(GetResolvedPacks(context.csolution->cbuildPack.packs, packs,
+    StrSet(selectedBy.begin(), selectedBy.end()), false)) != cbuildPackNode[YAML_HASH].as<string>("")) {
+    return false;
+  }
+
+  // restore context data otherwise set by processing
+  context.directories.cprj = node[YAML_CBUILD].as<string>(context.directories.cprj);
+  context.directories.cbuild = context.directories.cprj;
+  context.dependsOn = node[YAML_DEPENDS_ON].as<StrVec>(StrVec());
+  context.unusedPacks = node[YAML_PACKS_UNUSED].as<StrVec>(StrVec());
+  context.resolvedPacks = resolvedPacks;
+  const StrVec warns = ProjMgrLogger::Get().GetWarnsForContext(context.name);
+  for (const auto& msg : node[YAML_WARNINGS].as<StrVec>(StrVec())) {
+    if (find(warns.begin(), warns.end(), msg) == warns.end()) {
+      ProjMgrLogger::Get().Warn(msg, context.name);
+    }
+  }
+  context.upToDate = true;
+  return true;
+}
+
+bool ProjMgrFingerprint::Save(const ContextItem& context, const vector<ContextItem*>& contexts, bool cbuildgen) {
+  if (m_environment.empty()) {
+    return false;
+  }
+  // input files of the context and of the contexts it depends on
+  StrSet inputs = { context.csolution->path, context.cproject->path };
+  if (context.cdefault && !context.cdefault->path.empty()) {
+    inputs.insert(context.cdefault->path);
+  }
+  for (const auto& [clayer, _] : context.clayers) {
+    inputs.insert(clayer);
+  }
+  for (const auto& [gpdsc, _] : context.gpdscs) {
+    inputs.insert(gpdsc);
+  }
+  for (const auto& [_, fileInstances] : context.configFiles) {
+    for (const auto& [_, fi] : fileInstances) {
+      inputs.insert(fs::path(context.cproject->directory).append(fi->GetInstanceName()).generic_string());
+    }
+  }
+  for (const auto& dependency : context.dependsOn) {
+    for (const auto& item : contexts) {
+      if (item->name == dependency && item->cproject) {
+        inputs.insert(item->cproject->path);
+        for (const auto& [clayer, _] : item->clayers) {
+          inputs.insert(clayer);
+        }
+      }
+    }
+  }
+
+  // generated files
+  StrSet outputs = { context.directories.cbuild + "/" + context.name + ".cbuild.yml" };
+  if (cbuildgen) {
+    outputs.insert(RteFsUtils::MakePathCanonical(context.directories.cprj + "/" + context.name + ".cprj"));
+  }
+  if (context.rteActiveProject && context.rteActiveTarget) {
+    const string& rteComponents = context.rteActiveProject->GetProjectPath() +
+      context.rteActiveProject->GetRteComponentsH(context.rteActiveTarget->GetName(), "");
+    if (RteFsUtils::Exists(rteComponents)) {
+      outputs.insert(rteComponents);
+    }
+  }
+
+  // cbuild-pack entries of the context: its used packs and the packs selected by its requirements
+  StrSet packs, selectedBy;
+  for (const auto& [packId, package] : context.packages) {
+    if (context.localPackPaths.find(package->GetRootFilePath(false)) == context.localPackPaths.end()) {
+      packs.insert(packId);
+    }
+  }
+  for (const auto& [userInput, resolvedPacks] : context.userInputToResolvedPackIdMap) {
+    selectedBy.insert(userInput);
+    for (const auto& [resolvedPack, _] : resolvedPacks) {
+      packs.insert(resolvedPack);
+    }
+  }
+  for (const auto& packItem : context.packRequirements) {
+    if (packItem.path.empty()) {
+      selectedBy.insert(RtePackage::ComposePackageID(packItem.pack.vendor, packItem.pack.name, packItem.pack.version));
+    }
+  }
+  // read back the cbuild-pack.yml generated for the whole solution
+  vector<ResolvedPackItem> cbuildPack;
+  const string& cbuildPackFile = RteUtils::ExtractPrefix(context.csolution->path, ".csolution.yml") + ".cbuild-pack.yml";
+  if (RteFsUtils::Exists(cbuildPackFile)) {
+    try {
+      const YAML::Node& cbuildPackRoot = YAML::LoadFile(cbuildPackFile);
+      for (const auto& item : cbuildPackRoot[YAML_CBUILD_PACK][YAML_RESOLVED_PACKS]) {
+        cbuildPack.push_back({ item[YAML_RESOLVED_PACK].as<string>(""), item[YAML_SELECTED_BY_PACK].as<StrVec>(StrVec()) });
+      }
+    }
+    catch (YAML::Exception&) {
+      return false;
+    }
+  }
+
+  YAML::Node rootNode;
+  YAML::Node node = rootNode[YAML_FINGERPRINT];
+  node[YAML_GENERATED_BY] = ORIGINAL_FILENAME + string(" version ") + VERSION_STRING;
+  node[YAML_ENVIRONMENT] = m_environment;
+  node[YAML_CBUILD] = context.directories.cprj;
+  for (const auto& [clayer, _] : context.clayers) {
+    node[YAML_CLAYERS].push_back(clayer);
+  }
+  for (const auto& file : inputs) {
+    YAML::Node fileNode;
+    fileNode[YAML_FILE] = file;
+    fileNode[YAML_HASH] = GetFileHash(file);
+    node[YAML_INPUT].push_back(fileNode);
+  }
+  if (context.rteFilteredModel) {
+    for (const auto& [_, pack] : context.rteFilteredModel->GetPackages()) {
+      YAML::Node packNode;
+      packNode[YAML_PACK] = pack->GetPackageFileName();
+      packNode[YAML_TIME] = GetFileTime(pack->GetPackageFileName());
+      node[YAML_PACKS].push_back(packNode);
+    }
+  }
+  YAML::Node cbuildPackNode = node[YAML_CBUILD_PACK];
+  cbuildPackNode[YAML_HASH] = GetResolvedPacksHash(GetResolvedPacks(cbuildPack, packs, selectedBy, false));
+  for (const auto& item : selectedBy) {
+    cbuildPackNode[YAML_SELECTED_BY_PACK].push_back(item);
+  }
+  for (const auto& resolvedPack : GetResolvedPacks(cbuildPack, packs, selectedBy, true)) {
+    YAML::Node resolvedPackNode;
+    resolvedPackNode[YAML_RESOLVED_PACK] = resolvedPack.pack;
+    for (const auto& item : resolvedPack.selectedByPack) {
+      resolvedPackNode[YAML_SELECTED_BY_PACK].push_back(item);
+    }
+    cbuildPackNode[YAML_RESOLVED_PACKS].push_back(resolvedPackNode);
+  }
+  for (const auto& file : outputs) {
+    YAML::Node fileNode;
+    fileNode[YAML_FILE] = file;
+    fileNode[YAML_HASH] = GetFileHash(file);
+    node[YAML_OUTPUT].push_back(fileNode);
+  }
+  for (const auto& dependency : context.dependsOn) {
+    node[YAML_DEPENDS_ON].push_back(dependency);
+  }
+  for (const auto& pack : context.unusedPacks) {
+    node[YAML_PACKS_UNUSED].push_back(pack);
+  }
+  for (const auto& msg : ProjMgrLogger::Get().GetWarnsForContext(context.name)) {
+    node[YAML_WARNINGS].push_back(msg);
+  }
+
+  const string& filename = GetFilename(context);
+  if (!RteFsUtils::MakeSureFilePath(filename)) {
+    return false;
+  }
+  ofstream fileStream(filename);
+  if (!fileStream) {
+    return false;
+  }
+  YAML::Emitter emitter;
+  emitter << rootNode;
+  fileStream << emitter.c_str() << endl;
+  if (!fileStream.good()) {
+    return false;
+  }
+  LoadIndex(context);
+  m_index[context.name] = filename;
+  return true;
+}
+
+void ProjMgrFingerprint::Remove(const ContextItem& context) {
+  LoadIndex(context);
+  const auto it = m_index.find(context.name);
+  if (it != m_index.end()) {
+    if (RteFsUtils::Exists(it->second)) {
+      RteFsUtils::RemoveFile(it->second);
+    }
+    m_index.erase(it);
+  }
+  const string& filename = GetFilename(context);
+  if (RteFsUtils::Exists(filename)) {
+    RteFsUtils::RemoveFile(filename);
+  }
+}
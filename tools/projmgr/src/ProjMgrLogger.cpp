@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -27,7 +27,11 @@ bool ProjMgrLogger::m_verbose = false;
 // singleton instance
 static unique_ptr<ProjMgrLogger> theProjMgrLogger = 0;
 
-  ProjMgrLogger::ProjMgrLogger() {
+// buffer receiving messages of the current thread
+static thread_local ProjMgrLogger* theThreadBuffer = nullptr;
+
+  ProjMgrLogger::ProjMgrLogger() :
+  m_isBuffer(false) {
 }
 
   ProjMgrLogger::~ProjMgrLogger() {
@@ -35,6 +39,9 @@ static unique_ptr<ProjMgrLogger> theProjMgrLogger = 0;
 }
 
 ProjMgrLogger& ProjMgrLogger::Get() {
+  if (theThreadBuffer) {
+    return *theThreadBuffer;
+  }
   if (!theProjMgrLogger) {
     theProjMgrLogger = make_unique<ProjMgrLogger>();
   }
@@ -45,15 +52,51 @@ void ProjMgrLogger::ProjMgrLogger::Clear() {
   m_errors.clear();
   m_warns.clear();
   m_infos.clear();
+  m_buffer.clear();
   m_ss.str(""); // Clear previous contents
   m_ss.clear();
 }
 
+void ProjMgrLogger::SetThreadBuffer(ProjMgrLogger* buffer) {
+  if (buffer) {
+    buffer->m_isBuffer = true;
+  }
+  theThreadBuffer = buffer;
+}
+
+ProjMgrLogger* ProjMgrLogger::GetThreadBuffer(void) {
+  return theThreadBuffer;
+}
+
+void ProjMgrLogger::Replay(ProjMgrLogger& buffer) {
+  for (const auto& m : buffer.m_buffer) {
+    switch (m.level) {
+    case Level::Error:
+      Error(m.msg, m.context, m.file, m.line, m.column);
+      break;
+    case Level::Warn:
+      Warn(m.msg, m.context, m.file, m.line, m.column);
+      break;
+    case Level::Info:
+      Info(m.msg, m.context, m.file, m.line, m.column);
+      break;
+    case Level::Debug:
+      Debug(m.msg);
+      break;
+    }
+  }
+  buffer.Clear();
+}
+
 void ProjMgrLogger::Error(const string& msg, const string& context,
   const string& file, const int line, const int column) {
   const string mark = (line > 0 ? ":" + to_string(line) : "") + (column > 0 ? ":" + to_string(column) : "");
   CollectionUtils::PushBackUniquely(m_errors[context],
     (file.empty() ? "" : RteUtils::ExtractFileName(file) + mark + " - ") + msg);
+  if (m_isBuffer) {
+    m_buffer.push_back({ Level::Error, msg, context, file, line, column });
+    return;
+  }
   if(!m_silent) {
     cerr << (file.empty() ? "" : file + mark + " - ") << PROJMGR_ERROR << PROJMGR_TOOL << msg << endl;
   }
@@ -64,6 +107,10 @@ void ProjMgrLogger::Warn(const string& msg, const string& context,
   const string mark = (line > 0 ? ":" + to_string(line) : "") + (column > 0 ? ":" + to_string(column) : "");
   CollectionUtils::PushBackUniquely(m_warns[context],
     (file.empty() ? "" : RteUtils::ExtractFileName(file) + mark + " - ") + msg);
+  if (m_isBuffer) {
+    m_buffer.push_back({ Level::Warn, msg, context, file, line, column });
+    return;
+  }
   if (!IsQuiet()) {
     cerr << (file.empty() ? "" : file + mark + " - ") << PROJMGR_WARN << PROJMGR_TOOL << msg << endl;
   }
@@ -74,12 +121,20 @@ void ProjMgrLogger::Info(const string& msg, const string& context,
   const string mark = (line > 0 ? ":" + to_string(line) : "") + (column > 0 ? ":" + to_string(column) : "");
   CollectionUtils::PushBackUniquely(m_infos[context],
     (file.empty() ? "" : RteUtils::ExtractFileName(file) + mark + " - ") + msg);
+  if (m_isBuffer) {
+    m_buffer.push_back({ Level::Info, msg, context, file, line, column });
+    return;
+  }
   if (!IsQuiet() && IsVerbose()) {
     cout << (file.empty() ? "" : file + mark + " - ") << PROJMGR_INFO << PROJMGR_TOOL << msg << endl;
   }
 }
 
 void ProjMgrLogger::Debug(const string& msg) {
+  if (theThreadBuffer) {
+    theThreadBuffer->m_buffer.push_back({ Level::Debug, msg, "", "", 0, 0 });
+    return;
+  }
   if (!IsQuiet()) {
     cerr << PROJMGR_DEBUG << PROJMGR_TOOL << msg << endl;
   }
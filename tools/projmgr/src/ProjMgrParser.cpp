@@ -1,17 +1,139 @@
 /*
- * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include "ProjMgrParser.h"
+#include "ProjMgrLogger.h"
 #include "ProjMgrYamlParser.h"
 
+#include "RteFsUtils.h"
+#include "RtePackCache.h"
+
+#include <atomic>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 
 using namespace std;
 
+// state of a parsed file, the content is only hashed again if the modification time changed
+struct ParsedFileStamp {
+  bool exists = false;
+  uintmax_t size = 0;
+  fs::file_time_type time;
+  uint64_t hash = 0;
+};
+
+// parsed item with the stamps of the files it was parsed from
+template<typename T> struct ParsedItemCacheEntry {
+  vector<pair<string, ParsedFileStamp>> files;
+  bool checkSchema;
+  bool frozenPacks;
+  T item;
+};
+
+// items parsed during the process lifetime, keyed by canonical path and reused while the files are unchanged
+static map<string, ParsedItemCacheEntry<CdefaultItem>> theCdefaultCache;
+static map<string, ParsedItemCacheEntry<CsolutionItem>> theCsolutionCache;
+static map<string, ParsedItemCacheEntry<CprojectItem>> theCprojectCache;
+static map<string, ParsedItemCacheEntry<ClayerItem>> theClayerCache;
+static mutex theParsedItemCacheMutex;
+
+static ParsedFileStamp GetFileStamp(const string& file) {
+  ParsedFileStamp stamp;
+  error_code ec;
+  stamp.time = fs::last_write_time(file, ec);
+  if (ec) {
+    return stamp;
+  }
+  string buffer;
+  if (!RteFsUtils::ReadFile(file, buffer)) {
+    return stamp;
+  }
+  stamp.exists = true;
+  stamp.size = buffer.size();
+  stamp.hash = RtePackCache::CalcHash(buffer);
+  return stamp;
+}
+
+static bool IsFileUnchanged(const string& file, ParsedFileStamp& stamp) {
+  error_code ec;
+  if (!stamp.exists) {
+    return !fs::exists(file, ec);
+  }
+  const uintmax_t size = fs::file_size(file, ec);
+  if (ec || (size != stamp.size)) {
+    return false;
+  }
+  const auto time = fs::last_write_time(file, ec);
+  if (ec) {
+    return false;
+  }
+  if (time != stamp.time) {
+    // file was written again, it is unchanged if the content is the same
+    string buffer;
+    if (!RteFsUtils::ReadFile(file, buffer) || (RtePackCache::CalcHash(buffer) != stamp.hash)) {
+      return false;
+    }
+    stamp.time = time;
+  }
+  return true;
+}
+
+template<typename T>
+static bool GetCachedItem(map<string, ParsedItemCacheEntry<T>>& cache, const string& input,
+  bool checkSchema, bool frozenPacks, T& item) {
+  lock_guard<mutex> lock(theParsedItemCacheMutex);
+  const auto it = cache.find(RteFsUtils::MakePathCanonical(input));
+  if ((it == cache.end()) || (!it->second.checkSchema && checkSchema) || (it->second.frozenPacks != frozenPacks)) {
+    return false;
+  }
+  for (auto& [file, stamp] : it->second.files) {
+    if (!IsFileUnchanged(file, stamp)) {
+      cache.erase(it);
+      return false;
+    }
+  }
+  item = it->second.item;
+  return true;
+}
+
+template<typename T>
+static void SetCachedItem(map<string, ParsedItemCacheEntry<T>>& cache, const string& input,
+  const vector<pair<string, ParsedFileStamp>>& files, bool checkSchema, bool frozenPacks, const T& item) {
+  lock_guard<mutex> lock(theParsedItemCacheMutex);
+  cache[RteFsUtils::MakePathCanonical(input)] = { files, checkSchema, frozenPacks, item };
+}
+
+template<typename T>
+static void InvalidateCachedItems(map<string, ParsedItemCacheEntry<T>>& cache, const string& file) {
+  for (auto it = cache.begin(); it != cache.end();) {
+    const auto& files = it->second.files;
+    if (find_if(files.begin(), files.end(), [&](const auto& item) { return item.first == file; }) != files.end()) {
+      it = cache.erase(it);
+    } else {
+      it++;
+    }
+  }
+}
+
+// run a parse function with its messages redirected to a buffer,
+// silent is set if no message was reported, only such results are cached so that messages are reported each time
+template<typename F>
+static bool ParseBuffered(F parse, bool& silent) {
+  ProjMgrLogger* outer = ProjMgrLogger::GetThreadBuffer();
+  ProjMgrLogger logger;
+  ProjMgrLogger::SetThreadBuffer(&logger);
+  const bool ret = parse();
+  ProjMgrLogger::SetThreadBuffer(outer);
+  silent = logger.GetErrors().empty() && logger.GetWarns().empty() && logger.GetInfos().empty();
+  ProjMgrLogger::Get().Replay(logger);
+  return ret;
+}
+
 // Parser class for public interfacing
 // ParseCsolution and ParseCproject are forwarded to the implementation class
 
@@ -24,29 +146,175 @@ ProjMgrParser::~ProjMgrParser(void) {
 }
 
 bool ProjMgrParser::ParseCdefault(const string& input, bool checkSchema) {
+  if (GetCachedItem(theCdefaultCache, input, checkSchema, false, m_cdefault)) {
+    return true;
+  }
   // Parse solution file
-  return ProjMgrYamlParser().ParseCdefault(input, m_cdefault, checkSchema);
+  const vector<pair<string, ParsedFileStamp>> files = { { RteFsUtils::MakePathCanonical(input), GetFileStamp(input) } };
+  CdefaultItem cdefault;
+  bool silent = false;
+  const bool ret = ParseBuffered([&]() { return ProjMgrYamlParser().ParseCdefault(input, cdefault, checkSchema); }, silent);
+  if (ret && silent) {
+    SetCachedItem(theCdefaultCache, input, files, checkSchema, false, cdefault);
+  }
+  m_cdefault = cdefault;
+  return ret;
 }
 
 bool ProjMgrParser::ParseCsolution(const string& input, bool checkSchema, bool frozenPacks) {
-  // Parse solution file
-  return ProjMgrYamlParser().ParseCsolution(input, m_csolution, checkSchema, frozenPacks);
+  if (GetCachedItem(theCsolutionCache, input, checkSchema, frozenPacks, m_csolution)) {
+    return true;
+  }
+  // Parse solution file, the cbuild-pack file is parsed along
+  const string& cbuildPackFile = RteUtils::ExtractPrefix(input, ".csolution.yml") + ".cbuild-pack.yml";
+  const vector<pair<string, ParsedFileStamp>> files = {
+    { RteFsUtils::MakePathCanonical(input), GetFileStamp(input) },
+    { RteFsUtils::MakePathCanonical(cbuildPackFile), GetFileStamp(cbuildPackFile) },
+  };
+  CsolutionItem csolution;
+  bool silent = false;
+  const bool ret = ParseBuffered([&]() {
+    return ProjMgrYamlParser().ParseCsolution(input, csolution, checkSchema, frozenPacks); }, silent);
+  if (ret && silent) {
+    SetCachedItem(theCsolutionCache, input, files, checkSchema, frozenPacks, csolution);
+  }
+  m_csolution = csolution;
+  return ret;
 }
 
 bool ProjMgrParser::ParseCproject(const string& input, bool checkSchema, bool single) {
+  CprojectItem cproject;
+  if (GetCachedItem(theCprojectCache, input, checkSchema, false, cproject)) {
+    m_cprojects[input] = cproject;
+    if (single) {
+      m_csolution.directory = cproject.directory;
+      m_csolution.contexts.push_back({ input });
+    }
+    return true;
+  }
   // Parse project
-  return ProjMgrYamlParser().ParseCproject(
-    input, m_csolution, m_cprojects, single, checkSchema);
+  const vector<pair<string, ParsedFileStamp>> files = { { RteFsUtils::MakePathCanonical(input), GetFileStamp(input) } };
+  bool silent = false;
+  if (!ParseBuffered([&]() {
+    return ProjMgrYamlParser().ParseCproject(input, m_csolution, m_cprojects, single, checkSchema); }, silent)) {
+    return false;
+  }
+  if (silent) {
+    SetCachedItem(theCprojectCache, input, files, checkSchema, false, m_cprojects.at(input));
+  }
+  return true;
 }
 
 bool ProjMgrParser::ParseClayer(const string& input, bool checkSchema) {
+  if (m_clayers.find(input) != m_clayers.end()) {
+    // already parsed
+    return true;
+  }
+  ClayerItem clayer;
+  if (GetCachedItem(theClayerCache, input, checkSchema, false, clayer)) {
+    m_clayers[input] = clayer;
+    return true;
+  }
   // Parse layer file
-  return ProjMgrYamlParser().ParseClayer(input, m_clayers, checkSchema);
+  const vector<pair<string, ParsedFileStamp>> files = { { RteFsUtils::MakePathCanonical(input), GetFileStamp(input) } };
+  bool silent = false;
+  if (!ParseBuffered([&]() { return ProjMgrYamlParser().ParseClayer(input, m_clayers, checkSchema); }, silent)) {
+    return false;
+  }
+  if (silent) {
+    SetCachedItem(theClayerCache, input, files, checkSchema, false, m_clayers.at(input));
+  }
+  return true;
 }
 
 bool ProjMgrParser::ParseGenericClayer(const string& input, bool checkSchema) {
   // Parse generic layer file
-  return ProjMgrYamlParser().ParseClayer(input, m_genericClayers, checkSchema);
+  return ParseGenericClayers({ input }, checkSchema);
+}
+
+bool ProjMgrParser::ParseGenericClayers(const vector<string>& inputs, bool checkSchema) {
+  // each file is parsed at most once, its messages are collected and reported in the given order
+  struct ClayerState {
+    string input;
+    vector<pair<string, ParsedFileStamp>> files;
+    bool cached = false;
+    bool ret = true;
+    map<string, ClayerItem> clayers;
+    ProjMgrLogger logger;
+  };
+  vector<string> pending;
+  for (const auto& input : inputs) {
+    if ((m_genericClayers.find(input) == m_genericClayers.end()) &&
+      (find(pending.begin(), pending.end(), input) == pending.end())) {
+      pending.push_back(input);
+    }
+  }
+  vector<ClayerState> states(pending.size());
+  for (size_t i = 0; i < pending.size(); i++) {
+    ClayerState& state = states[i];
+    state.input = pending[i];
+    ClayerItem clayer;
+    if (GetCachedItem(theClayerCache, state.input, checkSchema, false, clayer)) {
+      state.clayers[state.input] = clayer;
+      state.cached = true;
+    }
+  }
+
+  // parse files in parallel
+  atomic<size_t> next(0);
+  auto worker = [&]() {
+    for (size_t i = next++; i < states.size(); i = next++) {
+      ClayerState& state = states[i];
+      if (!state.cached) {
+        state.files = { { RteFsUtils::MakePathCanonical(state.input), GetFileStamp(state.input) } };
+        ProjMgrLogger::SetThreadBuffer(&state.logger);
+        state.ret = ProjMgrYamlParser().ParseClayer(state.input, state.clayers, checkSchema);
+        ProjMgrLogger::SetThreadBuffer(nullptr);
+      }
+    }
+  };
+  const size_t uncached = count_if(states.begin(), states.end(), [](const ClayerState& state) { return !state.cached; });
+  const size_t nThreads = min<size_t>(max(thread::hardware_concurrency(), 1U), uncached);
+  vector<thread> threads;
+  for (size_t i = 0; i < nThreads; i++) {
+    threads.emplace_back(worker);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  // report results in the given order, stop at the first failure like sequential parsing
+  for (auto& state : states) {
+    // files reporting messages are not cached, so that their messages are reported each time
+    const bool cache = state.ret && !state.cached && state.logger.GetErrors().empty() &&
+      state.logger.GetWarns().empty() && state.logger.GetInfos().empty();
+    ProjMgrLogger::Get().Replay(state.logger);
+    if (!state.ret) {
+      return false;
+    }
+    if (cache) {
+      SetCachedItem(theClayerCache, state.input, state.files, checkSchema, false, state.clayers[state.input]);
+    }
+    m_genericClayers[state.input] = state.clayers[state.input];
+  }
+  return true;
+}
+
+void ProjMgrParser::InvalidateCache(const string& file) {
+  const string& canonical = RteFsUtils::MakePathCanonical(file);
+  lock_guard<mutex> lock(theParsedItemCacheMutex);
+  InvalidateCachedItems(theCdefaultCache, canonical);
+  InvalidateCachedItems(theCsolutionCache, canonical);
+  InvalidateCachedItems(theCprojectCache, canonical);
+  InvalidateCachedItems(theClayerCache, canonical);
+}
+
+void ProjMgrParser::ClearCache(void) {
+  lock_guard<mutex> lock(theParsedItemCacheMutex);
+  theCdefaultCache.clear();
+  theCsolutionCache.clear();
+  theCprojectCache.clear();
+  theClayerCache.clear();
 }
 
 bool ProjMgrParser::ParseCbuildSet(const string& input, bool checkSchema) {
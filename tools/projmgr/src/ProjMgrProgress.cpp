@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ProjMgrProgress.h"
+
+#include <memory>
+
+using namespace std;
+
+// singleton instance
+static unique_ptr<ProjMgrProgress> theProjMgrProgress = 0;
+
+ProjMgrProgress::ProjMgrProgress(void) :
+  m_interval(chrono::steady_clock::duration::zero()),
+  m_total(0),
+  m_done(0),
+  m_cancelled(false) {
+}
+
+ProjMgrProgress::~ProjMgrProgress(void) {
+  // Reserved
+}
+
+ProjMgrProgress& ProjMgrProgress::Get() {
+  if (!theProjMgrProgress) {
+    theProjMgrProgress = make_unique<ProjMgrProgress>();
+  }
+  return *theProjMgrProgress.get();
+}
+
+void ProjMgrProgress::SetReceiver(const Receiver& receiver) {
+  lock_guard<mutex> lock(m_mutex);
+  m_receiver = receiver;
+  m_title.clear();
+  m_total = m_done = 0;
+}
+
+void ProjMgrProgress::SetRate(unsigned int rate) {
+  lock_guard<mutex> lock(m_mutex);
+  m_interval = rate > 0 ? chrono::duration_cast<chrono::steady_clock::duration>(chrono::seconds(1)) / rate :
+    chrono::steady_clock::duration::zero();
+}
+
+void ProjMgrProgress::Start(const string& title, size_t total) {
+  lock_guard<mutex> lock(m_mutex);
+  if (!m_receiver) {
+    return;
+  }
+  m_title = title;
+  m_total = total;
+  m_done = 0;
+  m_last = chrono::steady_clock::now();
+  m_receiver(m_title, 0);
+}
+
+void ProjMgrProgress::Step(const string& item) {
+  lock_guard<mutex> lock(m_mutex);
+  if (!m_receiver || m_done >= m_total) {
+    return;
+  }
+  m_done++;
+  const auto now = chrono::steady_clock::now();
+  if (m_done < m_total && now - m_last < m_interval) {
+    return;
+  }
+  m_last = now;
+  m_receiver(m_title + ": " + item, static_cast<unsigned int>(m_done * 100 / m_total));
+}
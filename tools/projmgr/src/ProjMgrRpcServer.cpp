@@ -7,20 +7,27 @@
 #include "ProjMgrRpcServer.h"
 #include "ProjMgrRpcServerData.h"
 #include "ProjMgrLogger.h"
+#include "ProjMgrProgress.h"
 #include "ProjMgr.h"
 #include "ProductInfo.h"
 
-#include "CrossPlatformUtils.h"
 #include "RteFsUtils.h"
 #include "CollectionUtils.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
-#include <iostream>
 #include <regex>
+#include <shared_mutex>
+#include <thread>
 
 using namespace std;
 
-static constexpr const char* CONTENT_LENGTH_HEADER = "Content-Length:";
+static constexpr const char* CANCEL_REQUEST = "$/cancelRequest";
+static constexpr const char* PROGRESS = "$/progress";
+static constexpr const char* WORK_DONE_TOKEN = "workDoneToken";
+static constexpr int REQUEST_CANCELLED = -32800;
 
 ProjMgrRpcServer::ProjMgrRpcServer(ProjMgr& manager) :
   m_manager(manager) {
@@ -31,43 +38,11 @@ ProjMgrRpcServer::~ProjMgrRpcServer(void) {
 }
 
 const string ProjMgrRpcServer::GetRequestFromStdinWithLength(void) {
-  string line;
-  int contentLength = 0;
-  const string& header = CONTENT_LENGTH_HEADER;
-  while(getline(cin, line) && !cin.fail()) {
-    if(line.find(header) == 0) {
-      contentLength = RteUtils::StringToInt(line.substr(header.length()), 0);
-    }
-    if(line.empty() || line.front() == '\r' || line.front() == '\n') {
-      break;
-    }
-  }
-  string request(contentLength, '\0');
-  cin.read(&request[0], contentLength);
-  return request;
+  return m_transport.ReadMessageWithLength();
 }
 
 const string ProjMgrRpcServer::GetRequestFromStdin(void) {
-  string jsonData;
-  int braces = 0;
-  bool inJson = false;
-  char c;
-  while(cin.get(c) && !cin.fail()) {
-    if(c == '{') {
-      braces++;
-      inJson = true;
-    }
-    if(c == '}') {
-      braces--;
-    }
-    if(inJson) {
-      jsonData += c;
-    }
-    if(inJson && braces == 0) {
-      break;
-    }
-  }
-  return jsonData;
+  return m_transport.ReadMessage();
 }
 
 class RpcHandler : public RpcMethods {
@@ -75,7 +50,11 @@ public:
   RpcHandler(ProjMgrRpcServer& server, JsonRpc2Server& jsonServer) : RpcMethods(jsonServer),
     m_server(server),
     m_manager(server.GetManager()),
-    m_worker(server.GetManager().GetWorker()) {}
+    m_worker(server.GetManager().GetWorker()) {
+    // methods not (yet) covered by the generated interface
+    jsonServer.Add("GetComponentsTreeView", GetHandle(&RpcHandler::GetComponentsTreeView, *this), { "context", "all", "view" });
+    jsonServer.Add("ValidateComponentsDelta", GetHandle(&RpcHandler::ValidateComponentsDelta, *this), { "context", "revision" });
+  }
 
   RpcArgs::GetVersionResult GetVersion(void) override;
   RpcArgs::SuccessResult Shutdown(void) override;
@@ -93,16 +72,21 @@ public:
   RpcArgs::BoardList GetBoardList(const string& context, const string& namePattern, const string& vendor) override;
   RpcArgs::BoardInfo GetBoardInfo(const string& id) override;
   RpcArgs::CtRoot GetComponentsTree(const string& context, const bool& all) override;
+  RpcArgs::CtTreeView GetComponentsTreeView(const string& context, const bool& all, const RpcArgs::CtView& view);
   RpcArgs::SuccessResult SelectComponent(const string& context, const string& id, const int& count, const RpcArgs::Options& options) override;
   RpcArgs::SuccessResult SelectVariant(const string& context, const string& aggregateId, const string& variantName) override;
   RpcArgs::SuccessResult SelectBundle(const string& context, const string& className, const string& bundleName) override;
   RpcArgs::Results ValidateComponents(const string& context) override;
+  RpcArgs::ResultsDelta ValidateComponentsDelta(const string& context, const size_t& revision);
   RpcArgs::LogMessages GetLogMessages(void) override;
   RpcArgs::DraftProjectsInfo GetDraftProjects(const RpcArgs::DraftProjectsFilter& filter) override;
   RpcArgs::ConvertSolutionResult ConvertSolution(const string& solution, const string& activeTarget, const bool& updateRte) override;
   RpcArgs::DiscoverLayersInfo DiscoverLayers(const string& solution, const string& activeTarget) override;
   RpcArgs::ListMissingPacksResult ListMissingPacks(const string& solution, const string& activeTarget) override;
 
+  shared_mutex& GetStateMutex(void) { return m_stateMutex; }
+  void Publish(void);
+
 protected:
   enum Exception
   {
@@ -116,6 +100,7 @@ protected:
     PACKS_NOT_LOADED = -8,
     PACKS_LOADING_FAIL = -9,
     RTE_MODEL_ERROR = -10,
+    TREE_PATH_NOT_FOUND = -11,
   };
 
   ProjMgrRpcServer& m_server;
@@ -124,7 +109,30 @@ protected:
   bool m_solutionLoaded = false;
   bool m_bUseAllPacks = false;
 
+  // solution and RTE model state: locked exclusively by requests using it, shared by queries waiting for them
+  shared_mutex m_stateMutex;
+
+  // log messages and context variables published after each exclusive request, queried without using the state
+  mutex m_publishedMutex;
+  bool m_publishedSolution = false;
+  RpcArgs::LogMessages m_publishedMessages;
+  map<string, StrMap> m_publishedVariables;
+
   map<std::string, PackReferenceVector> m_packReferences; // packsInfo is used to simplify creation and access to references
+  map<std::string, RpcComponentsTree> m_componentsTrees; // components tree revisions per context
+  size_t m_componentsTreeRevision = 0; // last revision of any context, revisions stay unique when the model is reloaded
+
+  // validation results last returned by ValidateComponentsDelta
+  struct ValidationState {
+    size_t revision = 0;
+    const RteDependencySolver* solver = nullptr;
+    size_t solverRevision = 0; // dependency solver revision the results are based on
+    bool skipSelectable = false; // selectable results are omitted, see ProjMgrWorker::ValidateContext()
+    set<string> ids;
+    map<string, string> otherResults; // results not belonging to a selected aggregate, e.g. API conflicts
+  };
+  map<std::string, ValidationState> m_validationStates; // per context
+  size_t m_validationRevision = 0;
 
   PackReferenceVector& GetPackReferences(const string& context);
   PackReferenceVector CollectPackReferences(const string& context);
@@ -134,19 +142,305 @@ protected:
 
 
   void UpdateFilter(const string& context, RteTarget* rteTarget, bool bAll); // returns true if changed
+  RpcComponentsTree& GetComponentsTreeRevisions(const string& context);
+  set<string> CollectSelectedClasses(RteTarget* rteTarget) const;
+  void InvalidateComponentsTree(const string& context, const set<string>& classNames);
+  RpcArgs::Results CollectValidationResults(const string& context, RteItem::ConditionResult& validationRes);
   const ContextItem& GetContext(const string& context) const;
   RteTarget* GetActiveTarget(const string& context) const;
   RteComponentAggregate* GetComponentAggregate(const string& context, const string& id) const;
   void SetAggregateOptions(const string& context, RteComponentAggregate* rteAggregate, const RpcArgs::Options& options);
   void SetOptionsForNewlySelectedAggregates(const string& context, RteTarget* rteTarget, const RpcArgs::Options& options);
   bool CheckSolutionArg(string& solution, optional<string>& message) const;
+  void CheckCancelled(void);
+  RpcArgs::LogMessages CollectLogMessages(void) const;
+};
+
+// Requests are read by the server thread and handled by a pool of worker threads:
+// - GetVersion is handled immediately, also while other requests are running
+// - GetLogMessages and GetVariables read the messages and variables published by the last exclusive request,
+//   they are handled immediately unless an earlier exclusive request is queued or running, otherwise they
+//   lock the solution state shared and wait for the earlier requests
+// - all other requests lock the solution state exclusively
+// Ordered requests start in arrival order once they get their lock, their responses are sent in arrival order,
+// immediate responses may overtake them and are matched by id.
+// '$/cancelRequest' removes queued requests, a running exclusive request stops at its next check between
+// packs or contexts. Both respond with a 'request cancelled' error.
+// Exclusive requests carrying a 'workDoneToken' parameter report their progress with '$/progress'.
+class RpcDispatcher {
+public:
+  RpcDispatcher(ProjMgrRpcServer& server, JsonRpc2Server& jsonServer, RpcHandler& handler);
+  ~RpcDispatcher(void);
+
+  bool Dispatch(const string& request);
+  void Finish(void);
+
+protected:
+  enum class Access { IMMEDIATE, SHARED, EXCLUSIVE };
+  struct Request {
+    string request;
+    string handled;
+    string method;
+    json id;
+    json token;
+    Access access;
+    size_t sequence;
+  };
+
+  ProjMgrRpcServer& m_server;
+  JsonRpc2Server& m_jsonServer;
+  RpcHandler& m_handler;
+  mutex m_mutex;
+  condition_variable m_cv;
+  deque<Request> m_queue;
+  map<size_t, pair<string, string>> m_responses;
+  size_t m_nextSequence = 0;
+  size_t m_sendSequence = 0;
+  json m_runningId; // id of the running exclusive request
+  bool m_exclusiveRunning = false;
+  bool m_finish = false;
+  vector<thread> m_threads;
+
+  void Work(void);
+  deque<Request>::iterator FindRunnable(void);
+  bool Acquire(Access access);
+  void Release(Access access);
+  void Cancel(const json& id);
+  void Respond(const Request& request, const string& response);
+  void Progress(const json& token, const json& value);
 };
 
+RpcDispatcher::RpcDispatcher(ProjMgrRpcServer& server, JsonRpc2Server& jsonServer, RpcHandler& handler) :
+  m_server(server),
+  m_jsonServer(jsonServer),
+  m_handler(handler) {
+  m_handler.Publish();
+  const unsigned int threadCount = max(2U, min(thread::hardware_concurrency(), 4U));
+  for(unsigned int i = 0; i < threadCount; i++) {
+    m_threads.emplace_back(&RpcDispatcher::Work, this);
+  }
+}
+
+RpcDispatcher::~RpcDispatcher(void) {
+  Finish();
+}
+
+bool RpcDispatcher::Dispatch(const string& request) {
+  const json& message = json::parse(request, nullptr, false);
+  string method;
+  json id;
+  json token;
+  string handled = request;
+  if(message.is_object()) {
+    if(message.contains("method") && message["method"].is_string()) {
+      method = message["method"].get<string>();
+    }
+    if(message.contains("id")) {
+      id = message["id"];
+    }
+    if(message.contains("params") && message["params"].is_object() && message["params"].contains(WORK_DONE_TOKEN)) {
+      // the token is not a parameter of the method itself
+      token = message["params"][WORK_DONE_TOKEN];
+      json forwarded = message;
+      forwarded["params"].erase(WORK_DONE_TOKEN);
+      handled = forwarded.dump();
+    }
+  }
+  if(method == CANCEL_REQUEST) {
+    // notification, no response
+    if(message.contains("params") && message["params"].is_object() && message["params"].contains("id")) {
+      Cancel(message["params"]["id"]);
+    }
+    return true;
+  }
+  {
+    lock_guard<mutex> lock(m_mutex);
+    Access access = Access::EXCLUSIVE;
+    if(method == "GetVersion") {
+      access = Access::IMMEDIATE;
+    } else if(method == "GetLogMessages" || method == "GetVariables") {
+      // published data is only up to date when no earlier exclusive request is pending
+      const bool pending = m_exclusiveRunning || any_of(m_queue.begin(), m_queue.end(),
+        [](const Request& queued) { return queued.access == Access::EXCLUSIVE; });
+      access = pending ? Access::SHARED : Access::IMMEDIATE;
+    }
+    m_queue.push_back({ request, handled, method, id, token, access, access == Access::IMMEDIATE ? 0 : m_nextSequence++ });
+  }
+  m_cv.notify_all();
+  // no further requests are read after shutdown
+  return method != "Shutdown";
+}
+
+void RpcDispatcher::Finish(void) {
+  {
+    lock_guard<mutex> lock(m_mutex);
+    m_finish = true;
+  }
+  m_cv.notify_all();
+  for(auto& t : m_threads) {
+    t.join();
+  }
+  m_threads.clear();
+}
+
+deque<RpcDispatcher::Request>::iterator RpcDispatcher::FindRunnable(void) {
+  auto ordered = m_queue.end();
+  for(auto it = m_queue.begin(); it != m_queue.end(); it++) {
+    if(it->access == Access::IMMEDIATE) {
+      return it;
+    }
+    if(ordered == m_queue.end()) {
+      ordered = it;
+    }
+  }
+  // ordered requests start in arrival order
+  if((ordered != m_queue.end()) && Acquire(ordered->access)) {
+    return ordered;
+  }
+  return m_queue.end();
+}
+
+bool RpcDispatcher::Acquire(Access access) {
+  // the state is only locked by workers holding m_mutex, so waiting is done on m_cv instead
+  shared_mutex& state = m_handler.GetStateMutex();
+  return access == Access::SHARED ? state.try_lock_shared() : state.try_lock();
+}
+
+void RpcDispatcher::Release(Access access) {
+  shared_mutex& state = m_handler.GetStateMutex();
+  if(access == Access::SHARED) {
+    state.unlock_shared();
+  } else {
+    state.unlock();
+  }
+}
+
+void RpcDispatcher::Work(void) {
+  unique_lock<mutex> lock(m_mutex);
+  while(true) {
+    auto it = FindRunnable();
+    if(it == m_queue.end()) {
+      if(m_finish && m_queue.empty()) {
+        break;
+      }
+      m_cv.wait(lock);
+      continue;
+    }
+    const Request request = *it;
+    m_queue.erase(it);
+    if(request.access == Access::EXCLUSIVE) {
+      m_runningId = request.id;
+      m_exclusiveRunning = true;
+      ProjMgrProgress::Get().SetCancelled(false);
+    }
+    lock.unlock();
+    // only exclusive requests report progress, no other request reports meanwhile
+    const bool progress = !request.token.is_null() && request.access == Access::EXCLUSIVE;
+    if(progress) {
+      Progress(request.token, { { "kind", "begin" }, { "title", request.method }, { "percentage", 0 } });
+      ProjMgrProgress::Get().SetReceiver([&](const string& message, unsigned int percentage) {
+        Progress(request.token, { { "kind", "report" }, { "message", message }, { "percentage", percentage } });
+      });
+    }
+    const string& response = m_jsonServer.HandleRequest(request.handled);
+    if(progress) {
+      ProjMgrProgress::Get().SetReceiver(nullptr);
+      Progress(request.token, { { "kind", "end" } });
+    }
+    if(request.access == Access::EXCLUSIVE) {
+      m_handler.Publish();
+    }
+    lock.lock();
+    // respond before releasing access, so later requests respond later
+    Respond(request, response);
+    if(request.access != Access::IMMEDIATE) {
+      if(request.access == Access::EXCLUSIVE) {
+        m_runningId = nullptr;
+        m_exclusiveRunning = false;
+        ProjMgrProgress::Get().SetCancelled(false);
+      }
+      Release(request.access);
+    }
+    m_cv.notify_all();
+  }
+}
+
+void RpcDispatcher::Cancel(const json& id) {
+  lock_guard<mutex> lock(m_mutex);
+  if(id.is_null()) {
+    return;
+  }
+  if(id == m_runningId) {
+    // the running request stops at its next check, shared and immediate requests are too short to be cancelled
+    ProjMgrProgress::Get().SetCancelled(true);
+    return;
+  }
+  for(auto it = m_queue.begin(); it != m_queue.end(); it++) {
+    if(it->id == id) {
+      json response;
+      response["jsonrpc"] = "2.0";
+      response["id"] = id;
+      response["error"]["code"] = REQUEST_CANCELLED;
+      response["error"]["message"] = "request cancelled";
+      const Request request = *it;
+      m_queue.erase(it);
+      Respond(request, response.dump());
+      break;
+    }
+  }
+  m_cv.notify_all();
+}
+
+void RpcDispatcher::Respond(const Request& request, const string& response) {
+  if(request.access == Access::IMMEDIATE) {
+    m_server.SendResponse(request.request, response);
+    return;
+  }
+  m_responses[request.sequence] = { request.request, response };
+  for(auto it = m_responses.find(m_sendSequence); it != m_responses.end(); it = m_responses.find(m_sendSequence)) {
+    m_server.SendResponse(it->second.first, it->second.second);
+    m_responses.erase(it);
+    m_sendSequence++;
+  }
+}
+
+void RpcDispatcher::Progress(const json& token, const json& value) {
+  json notification;
+  notification["jsonrpc"] = "2.0";
+  notification["method"] = PROGRESS;
+  notification["params"]["token"] = token;
+  notification["params"]["value"] = value;
+  m_server.SendNotification(notification.dump());
+}
+
+void ProjMgrRpcServer::Send(const string& message) {
+  m_transport.WriteMessage(message, m_contextLength);
+}
+
+void ProjMgrRpcServer::SendNotification(const string& notification) {
+  lock_guard<mutex> lock(m_responseMutex);
+  Send(notification);
+}
+
+void ProjMgrRpcServer::SendResponse(const string& request, const string& response) {
+  lock_guard<mutex> lock(m_responseMutex);
+  Send(response);
+
+  if(m_debug) {
+    ofstream log;
+    log.open(RteFsUtils::GetCurrentFolder(true) + "csolution-rpc-log.txt", fstream::app);
+    log << request << std::endl;
+    log << response << std::endl;
+    log.close();
+  }
+}
+
 bool ProjMgrRpcServer::Run(void) {
   JsonRpc2Server jsonServer;
   RpcHandler handler(*this, jsonServer);
+  RpcDispatcher dispatcher(*this, jsonServer, handler);
 
-  while(!m_shutdown && !cin.fail()) {
+  while(!m_shutdown && !m_transport.IsEnd()) {
     // Get request
     const auto request = m_contextLength ?
       GetRequestFromStdinWithLength() :
@@ -156,30 +450,12 @@ bool ProjMgrRpcServer::Run(void) {
       continue;
     }
 
-    ofstream log;
-    if(m_debug) {
-      log.open(RteFsUtils::GetCurrentFolder(true) + "csolution-rpc-log.txt", fstream::app);
-      log << request << std::endl;
-    }
-
-    // Handle request
-    const auto response = jsonServer.HandleRequest(request);
-
-    // Send response
-    if(m_contextLength) {
-      // compliant to https://microsoft.github.io/language-server-protocol/specifications/lsp/3.17/specification/#baseProtocol
-      cout << CONTENT_LENGTH_HEADER << response.size() <<
-        CrossPlatformUtils::Crlf() << CrossPlatformUtils::Crlf() << response << std::flush;
-    } else {
-      cout << response << std::endl;
-    }
-
-    if(m_debug) {
-      log << response << std::endl;
-      log.close();
+    // Handle request, responses are sent by the dispatcher
+    if(!dispatcher.Dispatch(request)) {
+      break;
     }
-
   }
+  dispatcher.Finish();
   return true;
 }
 
@@ -196,6 +472,35 @@ bool RpcHandler::CheckSolutionArg(string& solution, optional<string>& message) c
   return true;
 }
 
+void RpcHandler::CheckCancelled(void) {
+  if(ProjMgrProgress::Get().IsCancelled()) {
+    // the interrupted request leaves no usable solution behind
+    m_solutionLoaded = false;
+    m_packReferences.clear();
+    throw JsonRpcException(REQUEST_CANCELLED, "request cancelled");
+  }
+}
+
+void RpcHandler::Publish(void) {
+  // called with the state locked, so published data is consistent
+  RpcArgs::LogMessages messages = CollectLogMessages();
+  map<string, StrMap> variables;
+  if(m_solutionLoaded) {
+    map<string, ContextItem>* contexts = nullptr;
+    m_worker.GetContexts(contexts);
+    for(const auto& context : m_worker.GetSelectedContexts()) {
+      const auto& contextItem = (*contexts)[context];
+      auto& contextVariables = variables[context];
+      contextVariables = contextItem.variables;
+      contextVariables.merge((StrMap)contextItem.absPathSequences);
+    }
+  }
+  lock_guard<mutex> lock(m_publishedMutex);
+  m_publishedSolution = m_solutionLoaded;
+  m_publishedMessages = std::move(messages);
+  m_publishedVariables = std::move(variables);
+}
+
 const ContextItem& RpcHandler::GetContext(const string& context) const {
   if(!m_solutionLoaded) {
     throw JsonRpcException(SOLUTION_NOT_LOADED, "a valid solution must be loaded before proceeding");
@@ -292,8 +597,11 @@ RpcArgs::SuccessResult RpcHandler::Resolve(const string& context, const RpcArgs:
   auto rteTarget = GetActiveTarget(context);
   auto rteProject = rteTarget->GetProject();
   if(rteProject) {
+    set<string> changedClasses = CollectSelectedClasses(rteTarget);
     result.success = rteProject->ResolveDependencies(rteTarget);
     SetOptionsForNewlySelectedAggregates(context, rteTarget, options);
+    changedClasses.merge(CollectSelectedClasses(rteTarget));
+    InvalidateComponentsTree(context, changedClasses);
 
     Apply(context);
   }
@@ -309,10 +617,13 @@ RpcArgs::SuccessResult RpcHandler::LoadPacks(void) {
   globalModel->Clear();
   globalModel->PurgeModel(true); // clears also explicit and non-existing packs
 
+  m_componentsTrees.clear();
+  m_validationStates.clear();
   m_worker.InitializeModel();
   m_worker.SetLoadPacksPolicy(LoadPacksPolicy::ALL);
   result.success = m_worker.LoadAllRelevantPacks();
   m_worker.SetLoadPacksPolicy(LoadPacksPolicy::DEFAULT);
+  CheckCancelled();
   if(!result.success) {
     result.message = "Packs failed to load";
   }
@@ -322,6 +633,8 @@ RpcArgs::SuccessResult RpcHandler::LoadPacks(void) {
 RpcArgs::SuccessResult RpcHandler::LoadSolution(const string& solution, const string& activeTarget) {
   m_bUseAllPacks = false; // loading solution will first use only listed packs
   m_packReferences.clear(); // will be updated
+  m_componentsTrees.clear(); // components trees are new
+  m_validationStates.clear();
   m_manager.Clear();
   m_solutionLoaded = false; // assume not loaded yet
   auto globalModel = ProjMgrKernel::Get()->GetGlobalModel();
@@ -348,6 +661,7 @@ RpcArgs::SuccessResult RpcHandler::LoadSolution(const string& solution, const st
   }
   // we disregard return value of m_manager.LoadSolution() here, because we tolerate some errors
   m_manager.LoadSolution(csolutionFile, activeTarget);
+  CheckCancelled();
   map<string, ContextItem>* contexts = nullptr;
   m_worker.GetContexts(contexts);
   bool hasUsableContext = false;
@@ -396,6 +710,7 @@ void RpcHandler::UpdateFilter(const string& context, RteTarget* rteTarget, bool
     rteTarget->UpdateFilterModel();  // updates available components
     rteTarget->GetProject()->UpdateModel(); // inserts already instantiated components
     rteTarget->EvaluateComponentDependencies();
+    m_componentsTrees.erase(context); // all classes can change
   }
 }
 
@@ -608,9 +923,19 @@ RpcArgs::PacksInfo RpcHandler::GetPacksInfo(const string& context, const bool& a
 RpcArgs::VariablesResult RpcHandler::GetVariables(const string& context) {
   RpcArgs::VariablesResult res;
   res.success = false;
-  auto& contextItem = GetContext(context);
-  res.variables = contextItem.variables;
-  res.variables.merge((StrMap)contextItem.absPathSequences);
+  // variables are taken from the published state, the dispatcher runs GetVariables after earlier exclusive requests
+  lock_guard<mutex> lock(m_publishedMutex);
+  if(!m_publishedSolution) {
+    throw JsonRpcException(SOLUTION_NOT_LOADED, "a valid solution must be loaded before proceeding");
+  }
+  if(context.empty()) {
+    throw JsonRpcException(CONTEXT_NOT_VALID, "'context' argument cannot be empty");
+  }
+  auto it = m_publishedVariables.find(context);
+  if(it == m_publishedVariables.end()) {
+    throw JsonRpcException(CONTEXT_NOT_FOUND, context + " was not found among selected contexts");
+  }
+  res.variables = it->second;
   res.success = true;
   return res;
 }
@@ -663,9 +988,63 @@ RpcArgs::CtRoot RpcHandler::GetComponentsTree(const string& context, const bool&
   return ctRoot;
 }
 
+RpcArgs::CtTreeView RpcHandler::GetComponentsTreeView(const string& context, const bool& all, const RpcArgs::CtView& view) {
+  RteTarget* rteTarget = GetActiveTarget(context);
+  UpdateFilter(context, rteTarget, all);
+
+  RpcDataCollector dc(rteTarget);
+  const vector<string>& path = view.path.has_value() ? view.path.value() : RteUtils::EMPTY_STRING_VECTOR;
+  if(!dc.HasCtNode(path)) {
+    throw JsonRpcException(TREE_PATH_NOT_FOUND, json(path).dump() + ": components tree path not found");
+  }
+  RpcComponentsTree& revisions = GetComponentsTreeRevisions(context);
+  RpcArgs::CtTreeView treeView;
+  treeView.revision = revisions.GetRevision();
+  treeView.delta = view.revision.has_value() && revisions.HasChanges(view.revision.value());
+  set<string> changedClasses;
+  if(treeView.delta) {
+    // only classes changed since the client's revision
+    changedClasses = revisions.GetChangedClasses(view.revision.value());
+  }
+  vector<vector<string>> collapsed;
+  dc.CollectCtSubtree(treeView.classes, treeView.delta ? &changedClasses : nullptr, path, view.depth.has_value() ? view.depth.value() : -1, collapsed);
+  if(!collapsed.empty()) {
+    treeView.collapsed = collapsed;
+  }
+  treeView.success = true;
+  return treeView;
+}
+
+RpcComponentsTree& RpcHandler::GetComponentsTreeRevisions(const string& context) {
+  auto it = m_componentsTrees.find(context);
+  if(it == m_componentsTrees.end()) {
+    // first request after loading the model: all classes are new
+    it = m_componentsTrees.emplace(context, RpcComponentsTree()).first;
+    it->second.Invalidate(++m_componentsTreeRevision);
+  }
+  return it->second;
+}
+
+set<string> RpcHandler::CollectSelectedClasses(RteTarget* rteTarget) const {
+  // dependency results are only shown for classes with selected components
+  set<string> classNames;
+  for(const auto& [rteAggregate, _] : rteTarget->CollectSelectedComponentAggregates()) {
+    classNames.insert(rteAggregate->GetCclassName());
+  }
+  return classNames;
+}
+
+void RpcHandler::InvalidateComponentsTree(const string& context, const set<string>& classNames) {
+  auto it = m_componentsTrees.find(context);
+  if(it != m_componentsTrees.end()) {
+    it->second.Invalidate(++m_componentsTreeRevision, classNames);
+  }
+}
+
 RpcArgs::SuccessResult RpcHandler::SelectComponent(const string& context, const string& id, const int& count, const RpcArgs::Options& options) {
   // first try full component ID
   RteTarget* activeTarget = GetActiveTarget(context);
+  set<string> changedClasses = CollectSelectedClasses(activeTarget);
   RteComponent* rteComponent = activeTarget->GetComponent(id);
   RteComponentAggregate* rteAggregate = nullptr;
   RpcArgs::SuccessResult result = {false};
@@ -678,6 +1057,9 @@ RpcArgs::SuccessResult RpcHandler::SelectComponent(const string& context, const
     rteComponent = rteAggregate->GetComponent();
   }
   SetAggregateOptions(context, rteAggregate, options);
+  changedClasses.merge(CollectSelectedClasses(activeTarget));
+  changedClasses.insert(rteAggregate->GetCclassName());
+  InvalidateComponentsTree(context, changedClasses);
   Apply(context);
   return result;
 }
@@ -695,10 +1077,15 @@ RpcArgs::SuccessResult RpcHandler::SelectVariant(const string& context, const st
     return result;
   }
 
+  RteTarget* rteTarget = GetActiveTarget(context);
+  set<string> changedClasses = CollectSelectedClasses(rteTarget);
   rteAggregate->SetSelectedVariant(variant);
   if(rteAggregate->IsSelected()) {
-    GetActiveTarget(context)->EvaluateComponentDependencies();
+    rteTarget->EvaluateComponentDependencies();
   }
+  changedClasses.merge(CollectSelectedClasses(rteTarget));
+  changedClasses.insert(rteAggregate->GetCclassName());
+  InvalidateComponentsTree(context, changedClasses);
   result.success = true;
   Apply(context);
   return result;
@@ -718,19 +1105,101 @@ RpcArgs::SuccessResult RpcHandler::SelectBundle(const string& context, const str
     result.message = "Bundle '" + bundleName + "' is not found for component class '" + className + "'";
     return result; // error => false
   }
+  set<string> changedClasses = CollectSelectedClasses(rteTarget);
   rteClass->SetSelectedBundleName(bundleName, true);
   Apply(context);
-  GetActiveTarget(context)->EvaluateComponentDependencies();
+  rteTarget->EvaluateComponentDependencies();
+  changedClasses.merge(CollectSelectedClasses(rteTarget));
+  changedClasses.insert(className);
+  InvalidateComponentsTree(context, changedClasses);
   result.success = true;
   return result;
 }
 
 
 RpcArgs::Results RpcHandler::ValidateComponents(const string& context) {
+  RteItem::ConditionResult validationRes;
+  return CollectValidationResults(context, validationRes);
+}
+
+RpcArgs::ResultsDelta RpcHandler::ValidateComponentsDelta(const string& context, const size_t& revision) {
+  RteItem::ConditionResult validationRes;
+  RpcArgs::ResultsDelta resultsDelta;
+  static_cast<RpcArgs::Results&>(resultsDelta) = CollectValidationResults(context, validationRes);
+  const vector<RpcArgs::Result> validation = resultsDelta.validation.value_or(vector<RpcArgs::Result>{});
+
+  RteTarget* rteTarget = GetActiveTarget(context);
+  const RteDependencySolver* solver = rteTarget->GetDependencySolver();
+  const bool skipSelectable = validationRes < RteItem::SELECTABLE;
+  set<string> ids;
+  for(const auto& r : validation) {
+    ids.insert(r.id);
+  }
+  set<string> selectedIds;
+  for(const auto& [a, _] : rteTarget->GetSelectedComponentAggregates()) {
+    selectedIds.insert(a->ConstructComponentID(true));
+    if(a->GetComponent()) {
+      selectedIds.insert(a->GetComponent()->ConstructComponentID(true));
+    }
+  }
+  map<string, string> otherResults;
+  for(const auto& r : validation) {
+    if(selectedIds.find(r.id) == selectedIds.end()) {
+      otherResults[r.id] = json(r).dump();
+    }
+  }
+  ValidationState& state = m_validationStates[context];
+  resultsDelta.delta = revision != 0 && revision == state.revision && solver == state.solver &&
+    skipSelectable == state.skipSelectable && solver->HasChanges(state.solverRevision);
+  if(resultsDelta.delta) {
+    // results of unchanged aggregates are the same, see RteDependencySolver::GetChangedAggregates()
+    set<string> changed;
+    for(auto a : solver->GetChangedAggregates(state.solverRevision)) {
+      changed.insert(a->ConstructComponentID(true));
+      if(a->GetComponent()) {
+        changed.insert(a->GetComponent()->ConstructComponentID(true));
+      }
+    }
+    // added and removed results are reported, other results are compared with the previous ones
+    for(const auto& id : ids) {
+      if(state.ids.find(id) == state.ids.end()) {
+        changed.insert(id);
+      }
+    }
+    for(const auto& [id, r] : otherResults) {
+      auto it = state.otherResults.find(id);
+      if(it == state.otherResults.end() || it->second != r) {
+        changed.insert(id);
+      }
+    }
+    for(const auto& id : state.ids) {
+      if(ids.find(id) == ids.end()) {
+        changed.insert(id);
+      }
+    }
+    resultsDelta.validation = vector<RpcArgs::Result>{};
+    for(const auto& r : validation) {
+      if(changed.find(r.id) != changed.end()) {
+        resultsDelta.validation->push_back(r);
+      }
+    }
+    resultsDelta.changed = vector<string>(changed.begin(), changed.end());
+  }
+  state.revision = ++m_validationRevision;
+  state.solver = solver;
+  state.solverRevision = solver->GetRevision();
+  state.skipSelectable = skipSelectable;
+  state.ids = ids;
+  state.otherResults = otherResults;
+  resultsDelta.revision = state.revision;
+  return resultsDelta;
+}
+
+RpcArgs::Results RpcHandler::CollectValidationResults(const string& context, RteItem::ConditionResult& validationRes) {
   auto contextItem = GetContext(context);
 
   RpcArgs::Results results;
-  auto validationRes = m_worker.ValidateContext(contextItem);
+  validationRes = m_worker.ValidateContext(contextItem);
   results.result = RteItem::ConditionResultToString(validationRes);
   if(validationRes < RteItem::ConditionResult::FULFILLED) {
     results.validation = vector<RpcArgs::Result>{};
@@ -761,6 +1230,12 @@ RpcArgs::Results RpcHandler::ValidateComponents(const string& context) {
 }
 
 RpcArgs::LogMessages RpcHandler::GetLogMessages(void) {
+  // messages are taken from the published state, GetLogMessages does not wait for running requests
+  lock_guard<mutex> lock(m_publishedMutex);
+  return m_publishedMessages;
+}
+
+RpcArgs::LogMessages RpcHandler::CollectLogMessages(void) const {
   StrVec infoVec;
   for(const auto& [_, info] : ProjMgrLogger::Get().GetInfos()) {
     for(const auto& msg : info) {
@@ -888,6 +1363,8 @@ RpcArgs::ConvertSolutionResult RpcHandler::ConvertSolution(const string& solutio
   }
   m_bUseAllPacks = false; // loading solution will first use only listed packs
   m_packReferences.clear(); // will be updated
+  m_componentsTrees.clear(); // components trees are new
+  m_validationStates.clear();
   m_solutionLoaded = false; // assume not loaded
   m_manager.Clear();
   auto globalModel = ProjMgrKernel::Get()->GetGlobalModel();
@@ -899,7 +1376,9 @@ RpcArgs::ConvertSolutionResult RpcHandler::ConvertSolution(const string& solutio
     globalModel->ClearProjects();
   }
 
-  if(!m_manager.RunConvert(csolutionFile, activeTarget, updateRte) || !ProjMgrLogger::Get().GetErrors().empty()) {
+  const bool converted = m_manager.RunConvert(csolutionFile, activeTarget, updateRte);
+  CheckCancelled();
+  if(!converted || !ProjMgrLogger::Get().GetErrors().empty()) {
     if(m_worker.HasVarDefineError()) {
       const auto& vars = m_worker.GetUndefLayerVars();
       result.undefinedLayers = StrVec(vars.begin(), vars.end());
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Arm Limited. All rights reserved.
+ * Copyright (c) 2025-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -294,13 +294,10 @@ void RpcDataCollector::CollectBoardList(RpcArgs::BoardList& boardList, const std
   if(!m_model) {
     return;
   }
-  auto& boards = m_model->GetBoards();
-  for(auto [name, rteBoard] : boards) {
-    if(vendor.empty() || rteBoard->GetVendorString() == vendor) {
-      if(namePattern.empty() || WildCards::MatchToPattern(name, namePattern)) {
-        boardList.boards.push_back(FromRteBoard(rteBoard, false));
-      }
-    }
+  list<RteBoard*> boards;
+  m_model->GetBoards(boards, namePattern, vendor);
+  for(auto rteBoard : boards) {
+    boardList.boards.push_back(FromRteBoard(rteBoard, false));
   }
 }
 
@@ -333,13 +330,58 @@ void RpcDataCollector::CollectBoardInfo(RpcArgs::BoardInfo& boardInfo, const std
 
 
 void RpcDataCollector::CollectCtClasses(RpcArgs::CtRoot& root) const {
+  CollectCtClasses(root.classes, nullptr, nullptr);
+}
+
+void RpcDataCollector::CollectCtSubtree(vector<CtClass>& classes, const set<string>* classNames,
+  const vector<string>& path, int depth, vector<vector<string>>& collapsed) const
+{
+  CtScope scope{ path, depth, collapsed, {} };
+  CollectCtClasses(classes, classNames, &scope);
+}
+
+bool RpcDataCollector::HasCtNode(const vector<string>& path) const {
+  if(path.empty()) {
+    return true;
+  }
+  auto classContainer = m_target ? m_target->GetClasses() : nullptr;
+  RteComponentGroup* rteGroup = classContainer ? get_or_null(classContainer->GetGroups(), path.front()) : nullptr;
+  if(!rteGroup) {
+    return false;
+  }
+  if(path.size() == 1) {
+    return true;
+  }
+  const string& bundleName = path[1];
+  if(!contains_key(rteGroup->GetBundleNames(), bundleName)) {
+    return false;
+  }
+  for(size_t level = 2; level < path.size(); level++) {
+    rteGroup = get_or_null(rteGroup->GetGroups(), path[level]);
+    if(!rteGroup || !rteGroup->HasBundleName(bundleName)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void RpcDataCollector::CollectCtClasses(vector<CtClass>& classes, const set<string>* classNames, CtScope* scope) const {
 
   auto classContainer = m_target ? m_target->GetClasses() : nullptr;
   if(!classContainer) {
     return; // can happen if no solution is loaded
   }
+  if(scope && scope->IsCollapsed()) {
+    if(!classContainer->GetGroups().empty()) {
+      scope->collapsed.push_back(scope->current);
+    }
+    return;
+  }
 
   for(auto [name, rteClass] : classContainer->GetGroups()) {
+    if((classNames && !contains_key(*classNames, name)) || (scope && !scope->Follows(name))) {
+      continue;
+    }
     RpcArgs::CtClass ctClass;
     ctClass.name = name;
     auto activeBundle = rteClass->GetSelectedBundleName();
@@ -352,13 +394,28 @@ void RpcDataCollector::CollectCtClasses(RpcArgs::CtRoot& root) const {
     if(!res.empty()) {
       ctClass.result = res;
     }
-    CollectCtBundles(ctClass, rteClass);
-    root.classes.push_back(ctClass);
+    if(scope) {
+      scope->current.push_back(name);
+    }
+    CollectCtBundles(ctClass, rteClass, scope);
+    if(scope) {
+      scope->current.pop_back();
+    }
+    classes.push_back(ctClass);
   }
 }
 
-void RpcDataCollector::CollectCtBundles(RpcArgs::CtClass& ctClass, RteComponentGroup* rteClass) const {
+void RpcDataCollector::CollectCtBundles(RpcArgs::CtClass& ctClass, RteComponentGroup* rteClass, CtScope* scope) const {
+  if(scope && scope->IsCollapsed()) {
+    if(!rteClass->GetBundleNames().empty()) {
+      scope->collapsed.push_back(scope->current);
+    }
+    return;
+  }
   for(auto [bundleName, bundleId] : rteClass->GetBundleNames()) {
+    if(scope && !scope->Follows(bundleName)) {
+      continue;
+    }
     m_target->GetFilteredBundles();
     CtBundle ctBundle;
     ctBundle.name = bundleName;
@@ -366,25 +423,37 @@ void RpcDataCollector::CollectCtBundles(RpcArgs::CtClass& ctClass, RteComponentG
     if(rteBundle) {
       ctBundle.bundle = FromRteItem<Bundle>(bundleName, rteBundle);
     }
-    CollectCtChildren(ctBundle, rteClass, bundleName);
+    if(scope) {
+      scope->current.push_back(bundleName);
+    }
+    CollectCtChildren(ctBundle, rteClass, bundleName, scope);
+    if(scope) {
+      scope->current.pop_back();
+    }
     // add to parent collection
     ctClass.bundles.push_back(ctBundle);
   }
 }
 
-void RpcDataCollector::CollectCtChildren(RpcArgs::CtTreeItem& parent, RteComponentGroup* parentRteGroup, const string& bundleName) const
+void RpcDataCollector::CollectCtChildren(RpcArgs::CtTreeItem& parent, RteComponentGroup* parentRteGroup, const string& bundleName, CtScope* scope) const
 {
-  // collect aggregates to this level
-  CollectCtAggregates(parent, parentRteGroup, bundleName);
+  // collect aggregates to this level, nodes above the requested subtree are collected without them
+  if(!scope || !scope->IsAncestor()) {
+    CollectCtAggregates(parent, parentRteGroup, bundleName);
+  }
   auto& rteGroups = parentRteGroup->GetGroups();
   if(rteGroups.empty()) {
     return;
   }
   vector<CtGroup> cgroups;
   for(auto [name, rteGroup] : rteGroups) {
-    if(!rteGroup->HasBundleName(bundleName)) {
+    if(!rteGroup->HasBundleName(bundleName) || (scope && !scope->Follows(name))) {
       continue;
     }
+    if(scope && scope->IsCollapsed()) {
+      scope->collapsed.push_back(scope->current);
+      return;
+    }
     CtGroup g;
     g.name = name;
     auto rteApi = rteGroup->GetApi();
@@ -399,9 +468,14 @@ void RpcDataCollector::CollectCtChildren(RpcArgs::CtTreeItem& parent, RteCompone
     if(!res.empty()) {
       g.result = res;
     }
-    // subgroups
-    CollectCtChildren(g, rteGroup, bundleName);
-    CollectCtAggregates(g, rteGroup,bundleName);
+    // subgroups and aggregates
+    if(scope) {
+      scope->current.push_back(name);
+    }
+    CollectCtChildren(g, rteGroup, bundleName, scope);
+    if(scope) {
+      scope->current.pop_back();
+    }
     // add to parent collection
     cgroups.push_back(g);
   }
@@ -469,4 +543,83 @@ void RpcDataCollector::CollectCtVariants(RpcArgs::CtAggregate& ctAggregate, RteC
   }
 }
 
+void RpcComponentsTree::Invalidate(size_t revision) {
+  m_revision = m_invalidated = revision;
+  m_classRevisions.clear();
+}
+
+void RpcComponentsTree::Invalidate(size_t revision, const set<string>& classNames) {
+  m_revision = revision;
+  for(const auto& className : classNames) {
+    m_classRevisions[className] = revision;
+  }
+}
+
+bool RpcComponentsTree::HasChanges(size_t revision) const {
+  return revision > 0 && revision >= m_invalidated && revision <= m_revision;
+}
+
+set<string> RpcComponentsTree::GetChangedClasses(size_t revision) const {
+  set<string> classNames;
+  for(const auto& [className, classRevision] : m_classRevisions) {
+    if(classRevision > revision) {
+      classNames.insert(className);
+    }
+  }
+  return classNames;
+}
+
+void RpcArgs::to_json(json& j, const CtView& v) {
+  j = json::object();
+  if(v.revision.has_value()) {
+    j["revision"] = v.revision.value();
+  }
+  if(v.path.has_value()) {
+    j["path"] = v.path.value();
+  }
+  if(v.depth.has_value()) {
+    j["depth"] = v.depth.value();
+  }
+}
+
+void RpcArgs::from_json(const json& j, CtView& v) {
+  v.revision = j.contains("revision") && !j.at("revision").is_null() ? optional<size_t>(j.at("revision").get<size_t>()) : nullopt;
+  v.path = j.contains("path") && !j.at("path").is_null() ? optional<vector<string>>(j.at("path").get<vector<string>>()) : nullopt;
+  v.depth = j.contains("depth") && !j.at("depth").is_null() ? optional<int>(j.at("depth").get<int>()) : nullopt;
+}
+
+void RpcArgs::to_json(json& j, const CtTreeView& v) {
+  to_json(j, static_cast<const SuccessResult&>(v));
+  j["revision"] = v.revision;
+  j["delta"] = v.delta;
+  j["classes"] = v.classes;
+  if(v.collapsed.has_value()) {
+    j["collapsed"] = v.collapsed.value();
+  }
+}
+
+void RpcArgs::from_json(const json& j, CtTreeView& v) {
+  from_json(j, static_cast<SuccessResult&>(v));
+  j.at("revision").get_to(v.revision);
+  j.at("delta").get_to(v.delta);
+  j.at("classes").get_to(v.classes);
+  v.collapsed = j.contains("collapsed") && !j.at("collapsed").is_null() ? optional<vector<vector<string>>>(j.at("collapsed").get<vector<vector<string>>>()) : nullopt;
+}
+
+void RpcArgs::to_json(json& j, const ResultsDelta& v) {
+  to_json(j, static_cast<const Results&>(v));
+  j["revision"] = v.revision;
+  j["delta"] = v.delta;
+  if(v.changed.has_value()) {
+    j["changed"] = v.changed.value();
+  }
+}
+
+void RpcArgs::from_json(const json& j, ResultsDelta& v) {
+  from_json(j, static_cast<Results&>(v));
+  j.at("revision").get_to(v.revision);
+  j.at("delta").get_to(v.delta);
+  v.changed = j.contains("changed") && !j.at("changed").is_null() ? optional<vector<string>>(j.at("changed").get<vector<string>>()) : nullopt;
+}
+
 // end of ProjMgrRpcServerData.cpp
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ProjMgrRpcTransport.h"
+
+#include "CrossPlatformUtils.h"
+#include "RteUtils.h"
+
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+static constexpr const char* CONTENT_LENGTH_HEADER = "Content-Length:";
+static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+// stream buffers of the standard streams before any redirection
+static streambuf* const STDIN_BUF = cin.rdbuf();
+static streambuf* const STDOUT_BUF = cout.rdbuf();
+
+ProjMgrRpcTransport::ProjMgrRpcTransport(void) :
+  m_buffer(BLOCK_SIZE),
+  m_begin(0),
+  m_end(0),
+  m_eof(false),
+  m_input(nullptr) {
+}
+
+ProjMgrRpcTransport::~ProjMgrRpcTransport(void) {
+  // Reserved
+}
+
+void ProjMgrRpcTransport::CheckInput(void) {
+  if(cin.rdbuf() != m_input) {
+    // input redirected, buffered data belongs to the previous input
+    m_input = cin.rdbuf();
+    m_begin = m_end = 0;
+    m_eof = false;
+  }
+}
+
+bool ProjMgrRpcTransport::Fill(void) {
+  // keep unconsumed data, grow buffer if it is full
+  if(m_begin > 0) {
+    memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+    m_end -= m_begin;
+    m_begin = 0;
+  }
+  if(m_end == m_buffer.size()) {
+    m_buffer.resize(m_buffer.size() * 2);
+  }
+  char* data = m_buffer.data() + m_end;
+  const size_t size = m_buffer.size() - m_end;
+  size_t count = 0;
+  if(m_input == STDIN_BUF) {
+    count = CrossPlatformUtils::ReadStdin(data, size);
+  } else if(m_input) {
+    // redirected input: take what is available, wait for a single character otherwise
+    const streamsize available = m_input->in_avail();
+    if(available > 0) {
+      count = (size_t)m_input->sgetn(data, min(available, (streamsize)size));
+    } else {
+      const int c = m_input->sbumpc();
+      if(c != char_traits<char>::eof()) {
+        *data = char_traits<char>::to_char_type(c);
+        count = 1;
+      }
+    }
+  }
+  m_eof = count == 0;
+  m_end += count;
+  return !m_eof;
+}
+
+bool ProjMgrRpcTransport::IsEnd(void) {
+  CheckInput();
+  return m_eof && m_begin == m_end;
+}
+
+string ProjMgrRpcTransport::ReadMessageWithLength(void) {
+  CheckInput();
+  const size_t headerLength = strlen(CONTENT_LENGTH_HEADER);
+  int contentLength = 0;
+  // header lines are terminated by an empty line, offsets are relative to m_begin
+  size_t offset = 0;
+  while(true) {
+    const char* line = m_buffer.data() + m_begin + offset;
+    const char* newLine = static_cast<const char*>(memchr(line, '\n', m_end - m_begin - offset));
+    if(!newLine) {
+      if(!Fill()) {
+        m_begin = m_end;
+        return RteUtils::EMPTY_STRING;
+      }
+      continue;
+    }
+    const size_t length = newLine - line;
+    offset += length + 1;
+    if(length == 0 || line[0] == '\r') {
+      break;
+    }
+    if(length >= headerLength && memcmp(line, CONTENT_LENGTH_HEADER, headerLength) == 0) {
+      contentLength = RteUtils::StringToInt(string(line + headerLength, length - headerLength), 0);
+    }
+  }
+  m_begin += offset;
+  if(contentLength <= 0) {
+    return RteUtils::EMPTY_STRING;
+  }
+  const size_t size = (size_t)contentLength;
+  while(m_end - m_begin < size) {
+    if(!Fill()) {
+      // incomplete message
+      m_begin = m_end;
+      return RteUtils::EMPTY_STRING;
+    }
+  }
+  string message(m_buffer.data() + m_begin, size);
+  m_begin += size;
+  return message;
+}
+
+string ProjMgrRpcTransport::ReadMessage(void) {
+  CheckInput();
+  int braces = 0;
+  bool inJson = false;
+  // offsets are relative to m_begin
+  size_t start = 0;
+  size_t offset = 0;
+  while(true) {
+    if(m_begin + offset == m_end) {
+      if(!Fill()) {
+        // incomplete message is passed on as it is
+        string message = inJson ? string(m_buffer.data() + m_begin + start, m_end - m_begin - start) : RteUtils::EMPTY_STRING;
+        m_begin = m_end;
+        return message;
+      }
+      continue;
+    }
+    const char c = m_buffer[m_begin + offset++];
+    if(c == '{') {
+      if(!inJson) {
+        start = offset - 1;
+      }
+      braces++;
+      inJson = true;
+    }
+    if(c == '}') {
+      braces--;
+    }
+    if(inJson && braces == 0) {
+      string message(m_buffer.data() + m_begin + start, offset - start);
+      m_begin += offset;
+      return message;
+    }
+  }
+}
+
+void ProjMgrRpcTransport::WriteMessage(const string& message, bool contentLength) {
+  string frame;
+  if(contentLength) {
+    // compliant to https://microsoft.github.io/language-server-protocol/specifications/lsp/3.17/specification/#baseProtocol
+    const string& header = CONTENT_LENGTH_HEADER + to_string(message.size()) +
+      CrossPlatformUtils::Crlf() + CrossPlatformUtils::Crlf();
+    frame.reserve(header.size() + message.size());
+    frame = header;
+    frame += message;
+  } else {
+    frame.reserve(message.size() + 1);
+    frame = message;
+    frame += '\n';
+  }
+  if(cout.rdbuf() == STDOUT_BUF) {
+    // output already written to std::cout goes first
+    cout.flush();
+    CrossPlatformUtils::WriteStdout(frame.data(), frame.size());
+  } else {
+    cout.write(frame.data(), frame.size());
+    cout.flush();
+  }
+}
+
+// end of ProjMgrRpcTransport.cpp
@@ -6,6 +6,7 @@
 
 #include "ProjMgrWorker.h"
 #include "ProjMgrLogger.h"
+#include "ProjMgrProgress.h"
 #include "ProjMgrYamlEmitter.h"
 
 #include "CrossPlatformUtils.h"
@@ -13,8 +14,10 @@
 #include "RteUtils.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <regex>
+#include <thread>
 
 using namespace std;
 
@@ -323,6 +326,38 @@ void ProjMgrWorker::GetExecutes(map<string, ExecutesItem>& executes) {
   executes = m_executes;
 }
 
+bool ProjMgrWorker::GetEnvironmentKeys(StrVec& keys) {
+  if (!InitializeModel()) {
+    return false;
+  }
+  keys.push_back("pack-root=" + m_packRoot);
+  keys.push_back("compiler-root=" + GetCompilerRoot());
+  // registered toolchains
+  for (const auto& envVar : m_envVars) {
+    if (envVar.find("_TOOLCHAIN_") != string::npos) {
+      keys.push_back("env=" + envVar);
+    }
+  }
+  // toolchain configuration files
+  RetrieveToolchainConfigFiles();
+  for (const auto& file : m_toolchainConfigFiles) {
+    keys.push_back("toolchain-config=" + file);
+  }
+  // installed and local packs
+  map<string, string, RtePackageComparator> pdscMap;
+  m_kernel->GetInstalledPdscFiles(pdscMap);
+  const string& localRepository = m_packRoot + "/.Local/local_repository.pidx";
+  if (RteFsUtils::Exists(localRepository)) {
+    pdscMap[localRepository] = localRepository;
+  }
+  for (const auto& [_, pdscFile] : pdscMap) {
+    keys.push_back("pack=" + pdscFile + '@' +
+      to_string(RteFsUtils::GetModificationTime(pdscFile).time_since_epoch().count()));
+  }
+  sort(keys.begin(), keys.end());
+  return true;
+}
+
 void ProjMgrWorker::SetOutputDir(const std::string& outputDir) {
   m_outputDir = outputDir;
 }
@@ -359,6 +394,18 @@ void ProjMgrWorker::SetCbuild2Cmake(bool cbuild2cmake) {
   m_cbuild2cmake = cbuild2cmake;
 }
 
+void ProjMgrWorker::SetJobs(unsigned int jobs) {
+  m_jobs = jobs;
+}
+
+void ProjMgrWorker::SetPackCache(bool packCache) {
+  m_packCache = packCache;
+}
+
+unsigned int ProjMgrWorker::GetJobs(void) const {
+  return m_jobs;
+}
+
 void ProjMgrWorker::SetPrintRelativePaths(bool bRelativePaths) {
   m_relativePaths = bRelativePaths;
 }
@@ -500,6 +547,8 @@ bool ProjMgrWorker::InitializeModel() {
     return false;
   }
   m_kernel->SetCmsisPackRoot(m_packRoot);
+  m_kernel->SetPackCacheEnabled(m_packCache);
+  m_kernel->SetPackLoadThreads(m_jobs); // pdsc files are parsed in parallel like contexts
   m_model->SetCallback(m_kernel->GetCallback());
   m_model->SetRootFileName(m_csolutionFile);
   return m_kernel->Init();
@@ -527,7 +576,7 @@ bool ProjMgrWorker::CollectAllRequiredPdscFiles() {
 bool ProjMgrWorker::LoadAllRelevantPacks() {
   m_loadedPacks.clear(); // the list will be updated, it should not contain dangling pointers
   // Get required pdsc files
-  std::list<std::string> pdscFiles;
+  UniqueVector<string> uniquePdscFiles;
   bool noPackRequirements = true;
   for (const auto& context : m_selectedContexts) {
     auto& contextItem = m_contexts.at(context);
@@ -535,17 +584,18 @@ bool ProjMgrWorker::LoadAllRelevantPacks() {
     for (const auto& [pdscFile, pathVer] : contextItem.pdscFiles) {
       const string& path = pathVer.first;
       if (!path.empty()) {
-        CollectionUtils::PushBackUniquely(pdscFiles, pdscFile);
+        uniquePdscFiles.PushBack(pdscFile);
       }
     }
     // then all others
     for (const auto& [pdscFile, pathVer] : contextItem.pdscFiles) {
       const string& path = pathVer.first;
       if (path.empty()) {
-        CollectionUtils::PushBackUniquely(pdscFiles, pdscFile);
+        uniquePdscFiles.PushBack(pdscFile);
       }
     }
   }
+  std::list<std::string> pdscFiles(uniquePdscFiles.begin(), uniquePdscFiles.end());
   // Check load packs policy
   if (noPackRequirements && (m_loadPacksPolicy == LoadPacksPolicy::REQUIRED)) {
     ProjMgrLogger::Get().Error("required packs must be specified");
@@ -559,6 +609,7 @@ bool ProjMgrWorker::LoadAllRelevantPacks() {
       return false;
     }
   }
+  ProjMgrProgress::Get().Start("loading packs", pdscFiles.size());
   if (!m_kernel->LoadAndInsertPacks(m_loadedPacks, pdscFiles)) {
     ProjMgrLogger::Get().Error("failed to load and insert packs");
     return CheckRteErrors();
@@ -794,23 +845,130 @@ void ProjMgrWorker::GetAllCombinations(const ConnectionsCollectionMap& src, cons
   std::vector<ConnectionsCollectionVec>& combinations, const ConnectionsCollectionVec& previous) {
   // combine items from a table of 'connections'
   // see an example in the test case ProjMgrWorkerUnitTests.GetAllCombinations
-  const auto nextIt = next(it, 1);
-  // iterate over the input columns
-  for (const auto& item : it->second) {
-    ConnectionsCollectionVec combination = previous;
-    if (!item.filename.empty()) {
-      combination.push_back(item);
+  ConnectionsSearch search;
+  for (auto column = it; column != src.end(); column++) {
+    search.columns.push_back(&column->second);
+  }
+  search.prune = false;
+  search.visit = [&](const ConnectionsCollectionVec& combination) {
+    combinations.push_back(combination);
+  };
+  ConnectionsCollectionVec combination = previous;
+  SearchCombinations(search, 0, combination);
+}
+
+void ProjMgrWorker::VisitCombinations(const ConnectionsCollectionMap& src, bool prune,
+  const function<void(const ConnectionsCollectionVec&)>& visit) {
+  // combine items from a table of 'connections' without collecting all combinations
+  // see an example in the test case ProjMgrWorkerUnitTests.VisitCombinations
+  if (src.empty()) {
+    return;
+  }
+  ConnectionsSearch search;
+  for (const auto& [_, column] : src) {
+    search.columns.push_back(&column);
+  }
+  // keys provided and consumed by the columns from each index onwards
+  search.remainingProvides.resize(search.columns.size() + 1);
+  search.remainingConsumes.resize(search.columns.size() + 1);
+  for (size_t index = search.columns.size(); index-- > 0;) {
+    search.remainingProvides[index] = search.remainingProvides[index + 1];
+    search.remainingConsumes[index] = search.remainingConsumes[index + 1];
+    for (const auto& item : *search.columns[index]) {
+      for (const auto& connect : item.connections) {
+        for (const auto& [key, _] : connect->provides) {
+          search.remainingProvides[index].insert(key);
+        }
+        for (const auto& [key, _] : connect->consumes) {
+          search.remainingConsumes[index].insert(key);
+        }
+      }
     }
-    if (nextIt != src.end()) {
-      // run recursively over the next item
-      GetAllCombinations(src, nextIt, combinations, combination);
-    } else {
-      // add a new combination containing an item from each column
-      combinations.push_back(combination);
+  }
+  search.prune = prune;
+  search.visit = visit;
+  ConnectionsCollectionVec combination;
+  SearchCombinations(search, 0, combination);
+}
+
+void ProjMgrWorker::SearchCombinations(const ConnectionsSearch& search, size_t index, ConnectionsCollectionVec& combination) {
+  if (index == search.columns.size()) {
+    // complete combination containing an item from each column
+    search.visit(combination);
+    return;
+  }
+  // iterate over the items of the current column
+  for (const auto& item : *search.columns[index]) {
+    if (item.filename.empty()) {
+      // optional layer type left out
+      SearchCombinations(search, index + 1, combination);
+      continue;
+    }
+    combination.push_back(item);
+    if (!search.prune || !IsCombinationDiscarded(combination,
+      search.remainingProvides[index + 1], search.remainingConsumes[index + 1])) {
+      // run recursively over the next column
+      SearchCombinations(search, index + 1, combination);
     }
+    combination.pop_back();
   }
 }
 
+bool ProjMgrWorker::IsCombinationDiscarded(const ConnectionsCollectionVec& combination,
+  const StrSet& remainingProvides, const StrSet& remainingConsumes) {
+  // a partial combination is discarded if its validation fails in a way
+  // that cannot be fixed by adding items from the remaining columns
+  const ConnectionsValidationResult result = ValidateConnections(combination);
+  if (result.valid) {
+    return false;
+  }
+  // active connects stay active, a connection provided multiple times remains conflicting
+  if (!result.conflicts.empty()) {
+    return true;
+  }
+  StrSet provided;
+  for (const auto& [connect, active] : result.activeConnectMap) {
+    if (active) {
+      for (const auto& [key, _] : connect->provides) {
+        provided.insert(key);
+      }
+    }
+  }
+  // consumed connections that are already provided with another value or cannot be provided anymore
+  for (const auto& failures : { &result.overflows, &result.incompatibles }) {
+    for (const auto& [key, _] : *failures) {
+      if ((provided.find(key) != provided.end()) || (remainingProvides.find(key) == remainingProvides.end())) {
+        return true;
+      }
+    }
+  }
+  // layers whose provided connections cannot be consumed anymore
+  if (!result.missedCollections.empty()) {
+    StrSet consumed = remainingConsumes;
+    for (const auto& item : combination) {
+      for (const auto& connect : item.connections) {
+        for (const auto& [key, _] : connect->consumes) {
+          consumed.insert(key);
+        }
+      }
+    }
+    for (const auto& collection : result.missedCollections) {
+      bool match = false;
+      for (const auto& connect : collection.connections) {
+        for (const auto& [key, _] : connect->provides) {
+          if (consumed.find(key) != consumed.end()) {
+            match = true;
+          }
+        }
+      }
+      if (!match) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 void ProjMgrWorker::GetAllSelectCombinations(const ConnectPtrMap& src, const ConnectPtrMap::iterator& it,
   std::vector<ConnectPtrVec>& combinations, const ConnectPtrVec& previous) {
   // combine items from a table of 'set select'
@@ -850,18 +1008,24 @@ bool ProjMgrWorker::CollectLayersFromSearchPath(const string& clayerSearchPath,
       ProjMgrLogger::Get().Error("clayer search path does not exist", "", absSearchPath);
       return false;
     }
+    StrVec clayerFiles;
+    const regex clayerRegex(".*\\.clayer\\.(yml|yaml)");
     for (auto& item : fs::recursive_directory_iterator(absSearchPath, ec)) {
       if (fs::is_regular_file(item, ec) && (!ec)) {
         const string& clayerFile = item.path().generic_string();
-        if (regex_match(clayerFile, regex(".*\\.clayer\\.(yml|yaml)"))) {
-          if (!m_parser->ParseGenericClayer(clayerFile, m_checkSchema)) {
-            return false;
-          }
-          ClayerItem* clayer = &m_parser->GetGenericClayers()[clayerFile];
-          CollectionUtils::PushBackUniquely(clayers[clayer->type], clayerFile);
+        if (regex_match(clayerFile, clayerRegex)) {
+          clayerFiles.push_back(clayerFile);
         }
       }
     }
+    // parse all found layers at once, they are independent from each other
+    if (!m_parser->ParseGenericClayers(clayerFiles, m_checkSchema)) {
+      return false;
+    }
+    for (const auto& clayerFile : clayerFiles) {
+      ClayerItem* clayer = &m_parser->GetGenericClayers()[clayerFile];
+      CollectionUtils::PushBackUniquely(clayers[clayer->type], clayerFile);
+    }
   }
   return true;
 }
@@ -890,14 +1054,11 @@ bool ProjMgrWorker::GetCandidateLayers(LayersDiscovering& discover) {
     }
   }
   // parse matched type layers
+  StrVec candidateFiles;
   for (const auto& [type, clayers] : discover.candidateClayers) {
-    for (const auto& clayer : clayers) {
-      if (!m_parser->ParseGenericClayer(clayer, m_checkSchema)) {
-        return false;
-      }
-    }
+    candidateFiles.insert(candidateFiles.end(), clayers.begin(), clayers.end());
   }
-  return true;
+  return m_parser->ParseGenericClayers(candidateFiles, m_checkSchema);
 }
 
 bool ProjMgrWorker::DiscoverMatchingLayers(ContextItem& context, string clayerSearchPath) {
@@ -963,14 +1124,10 @@ bool ProjMgrWorker::ProcessLayerCombinations(ContextItem& context, LayersDiscove
   // classify connections according to layer types and set config-ids
   ConnectionsCollectionMap classifiedConnections = ClassifyConnections(allConnections, discover.optionalTypeFlags);
 
-  // cross classified connections to get all combinations to be validated
-  vector<ConnectionsCollectionVec> combinations;
-  if (!classifiedConnections.empty()) {
-    GetAllCombinations(classifiedConnections, classifiedConnections.begin(), combinations);
-  }
-
-  // validate connections combinations
-  for (auto& combination : combinations) {
+  // cross classified connections and validate each combination,
+  // partial combinations that cannot become valid are skipped unless all checks are traced in debug mode
+  VisitCombinations(classifiedConnections, !m_debug, [&](const ConnectionsCollectionVec& visited) {
+    ConnectionsCollectionVec combination = visited;
 
     // validate connections
     ConnectionsValidationResult result = ValidateConnections(combination);
@@ -1024,7 +1181,7 @@ bool ProjMgrWorker::ProcessLayerCombinations(ContextItem& context, LayersDiscove
       PrintConnectionsValidation(result, debugMsg);
       debugMsg += "connections are " + string(result.valid ? "valid" : "invalid") + "\n";
     }
-  }
+  });
 
   // assess generic layers validation results
   if (!discover.candidateClayers.empty()) {
@@ -2050,7 +2207,8 @@ bool ProjMgrWorker::ProcessComponents(ContextItem& context) {
             return false;
           }
           // keep track of used generators
-          m_extGenerator->AddUsedGenerator(options, context.name);
+          const string contextName = context.name;
+          UpdateSharedState([this, options, contextName]() { m_extGenerator->AddUsedGenerator(options, contextName); });
           context.extGen[options.id] = options;
         }
       }
@@ -3860,7 +4018,7 @@ bool ProjMgrWorker::AddFile(const FileNode& src, vector<FileNode>& dst, ContextI
     if (!ProjMgrUtils::HasAccessSequence(src.file)) {
       const string file = RteFsUtils::LexicallyNormal(fs::path(context.directories.cprj).append(srcNode.file).generic_string());
       if (!RteFsUtils::Exists(file)) {
-        m_missingFiles[file] = srcNode;
+        UpdateSharedState([this, file, srcNode]() { m_missingFiles[file] = srcNode; });
       }
     }
   }
@@ -3931,7 +4089,7 @@ void ProjMgrWorker::CheckCompilerFilterSpelling(const string& compiler) {
       return;
     }
   }
-  CollectionUtils::PushBackUniquely(m_missingToolchains, compilerName);
+  UpdateSharedState([this, compilerName]() { CollectionUtils::PushBackUniquely(m_missingToolchains, compilerName); });
 }
 
 bool ProjMgrWorker::CheckType(const TypeFilter& typeFilter, const vector<TypePair>& typeVec) {
@@ -4049,12 +4207,12 @@ void ProjMgrWorker::CheckTypeFilterSpelling(const TypeFilter& typeFilter) {
       if (!typePair.build.empty() &&
         find(m_types.allBuildTypes.begin(), m_types.allBuildTypes.end(), typePair.build) == m_types.allBuildTypes.end()) {
         bool misspelled = find(m_types.allTargetTypes.begin(), m_types.allTargetTypes.end(), typePair.build) != m_types.allTargetTypes.end();
-        m_types.missingBuildTypes[typePair.build] = misspelled;
+        UpdateSharedState([this, typePair, misspelled]() { m_types.missingBuildTypes[typePair.build] = misspelled; });
       }
       if (!typePair.target.empty() &&
         find(m_types.allTargetTypes.begin(), m_types.allTargetTypes.end(), typePair.target) == m_types.allTargetTypes.end()) {
         bool misspelled = find(m_types.allBuildTypes.begin(), m_types.allBuildTypes.end(), typePair.target) != m_types.allBuildTypes.end();
-        m_types.missingTargetTypes[typePair.target] = misspelled;
+        UpdateSharedState([this, typePair, misspelled]() { m_types.missingTargetTypes[typePair.target] = misspelled; });
       }
     }
   }
@@ -4076,17 +4234,32 @@ void ProjMgrWorker::PrintMissingFilters(void) {
 
 bool ProjMgrWorker::ProcessContext(ContextItem& context, bool loadGenFiles, bool resolveDependencies, bool updateRteFiles) {
   bool ret = true;
-  ret &= LoadPacks(context);
-  context.rteActiveProject->SetAttribute("update-rte-files", updateRteFiles ? "1" : "0");
-  if (!ProcessPrecedences(context, BoardOrDevice::Both)) {
+  if (!ProcessContextPrecedences(context, updateRteFiles, ret) || !ProcessContextTarget(context, ret)) {
     return false;
   }
+  ProcessContextOutputs(context, loadGenFiles, resolveDependencies, ret);
+  return ret;
+}
+
+bool ProjMgrWorker::ProcessContextPrecedences(ContextItem& context, bool updateRteFiles, bool& ret) {
+  // modifies the global model and the project list: contexts are processed one by one
+  ret &= LoadPacks(context);
+  context.rteActiveProject->SetAttribute("update-rte-files", updateRteFiles ? "1" : "0");
+  return ProcessPrecedences(context, BoardOrDevice::Both);
+}
+
+bool ProjMgrWorker::ProcessContextTarget(ContextItem& context, bool& ret) {
+  // works on the context's own target, global model is only read: contexts can be processed in parallel
   if (!SetTargetAttributes(context, context.targetAttributes)) {
     return false;
   }
   ret &= ProcessLinkerOptions(context);
   ret &= ProcessGroups(context);
   ret &= ProcessComponents(context);
+  return true;
+}
+
+void ProjMgrWorker::ProcessContextOutputs(ContextItem& context, bool loadGenFiles, bool resolveDependencies, bool& ret) {
   if (loadGenFiles) {
     ret &= ProcessGpdsc(context);
     ret &= ProcessGeneratedLayers(context);
@@ -4121,13 +4294,130 @@ bool ProjMgrWorker::ProcessContext(ContextItem& context, bool loadGenFiles, bool
   ret &= ProcessImages(context);
   CheckMissingPackRequirements(context.name);
   CollectNpuInfo(context);
-  return ret;
+}
+
+// updates of shared worker members deferred by the current thread, nullptr if they are applied immediately
+static thread_local vector<function<void()>>* t_deferredUpdates = nullptr;
+
+void ProjMgrWorker::UpdateSharedState(const function<void()>& update) {
+  if (t_deferredUpdates) {
+    t_deferredUpdates->push_back(update);
+  } else {
+    update();
+  }
+}
+
+void ProjMgrWorker::ProcessContexts(const vector<ContextItem*>& contexts, bool loadGenFiles, bool resolveDependencies, bool updateRteFiles,
+  const function<void(ContextItem&, bool)>& processed) {
+  size_t nThreads = std::min<size_t>(m_jobs > 0 ? m_jobs : thread::hardware_concurrency(), contexts.size());
+  // contexts not yet processed when cancellation is requested are reported as failed
+  const ProjMgrProgress& progress = ProjMgrProgress::Get();
+  if (nThreads <= 1) {
+    for (auto context : contexts) {
+      processed(*context, !progress.IsCancelled() && ProcessContext(*context, loadGenFiles, resolveDependencies, updateRteFiles));
+    }
+    return;
+  }
+
+  // messages and shared state updates of each context are collected and reported in the given order
+  struct ContextState {
+    bool ret = true;
+    bool proceed = true;
+    int activeProjectId = 0;
+    ProjMgrLogger logger;
+    ProjMgrCallback callback;
+    vector<function<void()>> updates;
+  };
+  vector<ContextState> states(contexts.size());
+  auto collect = [](ContextState* state) {
+    ProjMgrLogger::SetThreadBuffer(state ? &state->logger : nullptr);
+    t_deferredUpdates = state ? &state->updates : nullptr;
+  };
+
+  // load packs and apply precedences one by one
+  for (size_t i = 0; i < contexts.size(); i++) {
+    if (progress.IsCancelled()) {
+      states[i].proceed = states[i].ret = false;
+      continue;
+    }
+    collect(&states[i]);
+    states[i].proceed = ProcessContextPrecedences(*contexts[i], updateRteFiles, states[i].ret);
+    // following steps see the active project as left by this step, like in sequential processing
+    states[i].activeProjectId = m_model->GetActiveProjectId();
+    collect(nullptr);
+  }
+  const int activeProjectId = m_model->GetActiveProjectId();
+
+  // set up targets and resolve components in parallel unless the model already reports errors:
+  // errors are kept by the callback and make the following contexts fail as well,
+  // a context seeing another context's project as active one depends on its state as well
+  ProjMgrCallback* callback = m_kernel->GetCallback();
+  if (!callback->GetErrorMessages().empty()) {
+    nThreads = 1;
+  }
+  for (size_t i = 0; i < contexts.size(); i++) {
+    if (states[i].proceed && states[i].activeProjectId != contexts[i]->rteActiveProject->GetProjectId()) {
+      nThreads = 1;
+    }
+  }
+  atomic<size_t> next(0);
+  auto worker = [&]() {
+    for (size_t i = next++; i < contexts.size(); i = next++) {
+      ContextState& state = states[i];
+      if (progress.IsCancelled()) {
+        state.proceed = state.ret = false;
+      }
+      if (!state.proceed) {
+        continue;
+      }
+      collect(&state);
+      if (nThreads > 1) {
+        ProjMgrCallback::SetThreadCallback(&state.callback);
+        state.callback.SetProject(m_model->GetProject(state.activeProjectId));
+      } else {
+        m_model->SetActiveProjectId(state.activeProjectId);
+      }
+      state.proceed = ProcessContextTarget(*contexts[i], state.ret);
+      ProjMgrCallback::SetThreadCallback(nullptr);
+      collect(nullptr);
+    }
+  };
+  vector<thread> threads;
+  for (size_t i = 1; i < nThreads; i++) {
+    threads.emplace_back(worker);
+  }
+  worker(); // calling thread is a worker as well
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  // process generated files and outputs one by one, report results in the given order
+  for (size_t i = 0; i < contexts.size(); i++) {
+    ContextState& state = states[i];
+    ContextItem& context = *contexts[i];
+    callback->Merge(state.callback);
+    for (const auto& update : state.updates) {
+      update();
+    }
+    if (progress.IsCancelled()) {
+      state.proceed = state.ret = false;
+    }
+    if (state.proceed) {
+      m_model->SetActiveProjectId(state.activeProjectId);
+      ProjMgrLogger::SetThreadBuffer(&state.logger);
+      ProcessContextOutputs(context, loadGenFiles, resolveDependencies, state.ret);
+      ProjMgrLogger::SetThreadBuffer(nullptr);
+    }
+    ProjMgrLogger::Get().Replay(state.logger);
+    processed(context, state.proceed && state.ret);
+  }
+  m_model->SetActiveProjectId(activeProjectId);
 }
 
 bool ProjMgrWorker::ListPacks(vector<string>&packs, bool bListMissingPacksOnly, bool bLocked, const string& filter) {
   map<string, string, RtePackageComparator> packsMap;
   StrMap availablePackVersions;
-  list<string> pdscFiles;
+  UniqueVector<string> uniquePdscFiles;
   if (!InitializeModel()) {
     return false;
   }
@@ -4155,18 +4445,19 @@ bool ProjMgrWorker::ListPacks(vector<string>&packs, bool bListMissingPacksOnly,
       for(const auto& [pdscFile, pathVer] : context.pdscFiles) {
         const string& path = pathVer.first;
         if(!path.empty()) {
-          CollectionUtils::PushBackUniquely(pdscFiles, pdscFile);
+          uniquePdscFiles.PushBack(pdscFile);
         }
       }
       // then all others
       for(const auto& [pdscFile, pathVer] : context.pdscFiles) {
         const string& path = pathVer.first;
         if(path.empty()) {
-          CollectionUtils::PushBackUniquely(pdscFiles, pdscFile);
+          uniquePdscFiles.PushBack(pdscFile);
         }
       }
     }
   }
+  list<string> pdscFiles(uniquePdscFiles.begin(), uniquePdscFiles.end());
   if (!bListMissingPacksOnly) {
     // Check load packs policy
     if (pdscFiles.empty() && (m_loadPacksPolicy == LoadPacksPolicy::REQUIRED)) {
@@ -5030,29 +5321,45 @@ void ProjMgrWorker::UpdateMisc(vector<MiscItem>& vec, const string& compiler) {
 }
 
 void ProjMgrWorker::AddMiscUniquely(MiscItem& dst, vector<vector<MiscItem>*>& vec) {
-  for (auto& src : vec) {
-    AddMiscUniquely(dst, *src);
+  // flags are collected in insertion ordered unique vectors across all sources
+  struct {
+    UniqueVector<string> as, c, cpp, c_cpp, link, link_c, link_cpp, lib, library;
+  } flags;
+  const vector<pair<vector<string>*, UniqueVector<string>*>> fields = {
+    { &dst.as, &flags.as }, { &dst.c, &flags.c }, { &dst.cpp, &flags.cpp }, { &dst.c_cpp, &flags.c_cpp },
+    { &dst.link, &flags.link }, { &dst.link_c, &flags.link_c }, { &dst.link_cpp, &flags.link_cpp },
+    { &dst.lib, &flags.lib }, { &dst.library, &flags.library },
+  };
+  for (const auto& [dstField, flagsField] : fields) {
+    flagsField->AddItems(*dstField);
+  }
+  for (auto& srcVec : vec) {
+    for (auto& src : *srcVec) {
+      if (ProjMgrUtils::AreCompilersCompatible(src.forCompiler, dst.forCompiler)) {
+        // Copy individual flags
+        flags.as.AddItems(src.as);
+        flags.c.AddItems(src.c);
+        flags.cpp.AddItems(src.cpp);
+        flags.c_cpp.AddItems(src.c_cpp);
+        flags.link.AddItems(src.link);
+        flags.link_c.AddItems(src.link_c);
+        flags.link_cpp.AddItems(src.link_cpp);
+        flags.lib.AddItems(src.lib);
+        flags.library.AddItems(src.library);
+        // Propagate C-CPP flags
+        flags.c.AddItems(flags.c_cpp);
+        flags.cpp.AddItems(flags.c_cpp);
+      }
+    }
+  }
+  for (const auto& [dstField, flagsField] : fields) {
+    *dstField = flagsField->GetItems();
   }
 }
 
 void ProjMgrWorker::AddMiscUniquely(MiscItem& dst, vector<MiscItem>& vec) {
-  for (auto& src : vec) {
-    if (ProjMgrUtils::AreCompilersCompatible(src.forCompiler, dst.forCompiler)) {
-      // Copy individual flags
-      CollectionUtils::AddStringItemsUniquely(dst.as, src.as);
-      CollectionUtils::AddStringItemsUniquely(dst.c, src.c);
-      CollectionUtils::AddStringItemsUniquely(dst.cpp, src.cpp);
-      CollectionUtils::AddStringItemsUniquely(dst.c_cpp, src.c_cpp);
-      CollectionUtils::AddStringItemsUniquely(dst.link, src.link);
-      CollectionUtils::AddStringItemsUniquely(dst.link_c, src.link_c);
-      CollectionUtils::AddStringItemsUniquely(dst.link_cpp, src.link_cpp);
-      CollectionUtils::AddStringItemsUniquely(dst.lib, src.lib);
-      CollectionUtils::AddStringItemsUniquely(dst.library, src.library);
-      // Propagate C-CPP flags
-      CollectionUtils::AddStringItemsUniquely(dst.c, dst.c_cpp);
-      CollectionUtils::AddStringItemsUniquely(dst.cpp, dst.c_cpp);
-    }
-  }
+  vector<vector<MiscItem>*> srcVec = { &vec };
+  AddMiscUniquely(dst, srcVec);
 }
 
 bool ProjMgrWorker::ExecuteGenerator(std::string& generatorId) {
@@ -5486,24 +5793,61 @@ bool ProjMgrWorker::IsCollectionSubset(const ConnectionsCollectionVec& collectio
 }
 
 void ProjMgrWorker::RemoveRedundantSubsets(std::vector<ConnectionsCollectionVec>& validConnections) {
-  auto it = validConnections.begin();
-  while (it < validConnections.end()) {
-    bool isSubset = false;
-    for (auto it2 = validConnections.begin(); it2 < validConnections.end(); it2++) {
-      if (it == it2) {
+  // signature bits of layer files and connects of each combination,
+  // a combination can only be a subset of another one if the other signature includes all its bits
+  map<string, size_t> fileBits;
+  map<const ConnectItem*, size_t> connectBits;
+  for (const auto& combination : validConnections) {
+    for (const auto& item : combination) {
+      fileBits.emplace(item.filename, fileBits.size());
+      for (const auto& connect : item.connections) {
+        connectBits.emplace(connect, connectBits.size());
+      }
+    }
+  }
+  const size_t words = (fileBits.size() + connectBits.size() + 63) / 64;
+  vector<vector<uint64_t>> signatures;
+  for (const auto& combination : validConnections) {
+    vector<uint64_t> signature(words, 0);
+    for (const auto& item : combination) {
+      const size_t fileBit = fileBits.at(item.filename);
+      signature[fileBit / 64] |= uint64_t(1) << (fileBit % 64);
+      for (const auto& connect : item.connections) {
+        const size_t connectBit = fileBits.size() + connectBits.at(connect);
+        signature[connectBit / 64] |= uint64_t(1) << (connectBit % 64);
+      }
+    }
+    signatures.push_back(signature);
+  }
+  const auto isIncluded = [&](const vector<uint64_t>& subset, const vector<uint64_t>& superset) {
+    for (size_t word = 0; word < words; word++) {
+      if (subset[word] & ~superset[word]) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // remove combinations that are subsets of any other remaining combination
+  vector<bool> removed(validConnections.size(), false);
+  for (size_t i = 0; i < validConnections.size(); i++) {
+    for (size_t j = 0; j < validConnections.size(); j++) {
+      if ((i == j) || removed[j]) {
         continue;
       }
-      if (IsCollectionSubset(*it, *it2)) {
-        isSubset = true;
+      if (isIncluded(signatures[i], signatures[j]) && IsCollectionSubset(validConnections[i], validConnections[j])) {
+        removed[i] = true;
         break;
       }
     }
-    if (isSubset) {
-      it = validConnections.erase(it);
-    } else {
-      it++;
+  }
+  vector<ConnectionsCollectionVec> remaining;
+  for (size_t i = 0; i < validConnections.size(); i++) {
+    if (!removed[i]) {
+      remaining.push_back(move(validConnections[i]));
     }
   }
+  validConnections = move(remaining);
 }
 
 StrSet ProjMgrWorker::GetValidSets(ContextItem& context, const string& clayer) {
@@ -6157,7 +6501,17 @@ bool ProjMgrWorker::CheckPackVerAndCollectRelNotes(std::vector<std::string>& res
 }
 
 bool ProjMgrWorker::ReadPackReleaseNotes(const string& pdscFile, const string& currentVersion, const string& latestVersion, vector<string>& releaseNotes) {
-  RtePackage* pack = m_kernel->LoadPack(pdscFile);
+  // only releases are needed: use loaded pack or scan pdsc header
+  RtePackage* pack = m_kernel->GetPackRegistry()->GetPack(pdscFile);
+  unique_ptr<RtePackage> scannedPack;
+  if (!pack || pack->IsFileTimeModified()) {
+    scannedPack = m_kernel->ScanPack(pdscFile, { "releases" });
+    pack = scannedPack.get();
+    if (!pack || !pack->GetReleases()) {
+      // scan failed or missed the releases: load complete pack, it also reports errors
+      pack = m_kernel->LoadPack(pdscFile);
+    }
+  }
   if (!pack) { return false; }
 
   RteItem* releases = pack->GetReleases();
@@ -6188,7 +6542,7 @@ bool ProjMgrWorker::ReadPackReleaseNotes(const string& pdscFile, const string& c
 void ProjMgrWorker::CollectUnusedPacks() {
   for (const auto& contextName : m_selectedContexts) {
     auto& context = m_contexts[contextName];
-    if (context.packRequirements.empty()) {
+    if (context.packRequirements.empty() || context.upToDate) {
       continue;
     }
     context.unusedPacks.clear();
@@ -6,6 +6,7 @@
 
 #include "ProductInfo.h"
 #include "ProjMgrLogger.h"
+#include "ProjMgrParser.h"
 #include "ProjMgrYamlEmitter.h"
 #include "ProjMgrYamlParser.h"
 #include "ProjMgrYamlSchemaChecker.h"
@@ -74,6 +75,7 @@ bool ProjMgrYamlEmitter::WriteFile(YAML::Node& rootNode, const std::string& file
     fileStream << endl;
     fileStream << flush;
     fileStream.close();
+    ProjMgrParser::InvalidateCache(filename);
     ProjMgrLogger::Get().Info("file generated successfully", context, filename);
 
     // Check generated file schema
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022 Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -10,10 +10,71 @@
 #include "CrossPlatformUtils.h"
 #include "RteFsUtils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 
 using namespace std;
 
+// result of a prevalidated file, only valid while the file is unchanged
+struct PrevalidationResult {
+  fs::file_time_type time;
+  bool result;
+  list<RteError> errors;
+};
+
+static map<string, PrevalidationResult> thePrevalidationResults;
+static mutex theSchemaCheckerMutex;
+
+void ProjMgrYamlSchemaChecker::Prevalidate(const vector<string>& files)
+{
+  // files without schema are left to Validate() for reporting
+  vector<pair<string, string>> pending;
+  for (const auto& file : files) {
+    if (!RteFsUtils::Exists(file) || find_if(pending.begin(), pending.end(),
+      [&](const auto& item) { return item.first == file; }) != pending.end()) {
+      continue;
+    }
+    const string& schemaFile = ProjMgrYamlSchemaChecker().FindSchema(file);
+    if (!schemaFile.empty()) {
+      pending.push_back({ file, schemaFile });
+    }
+  }
+  if (pending.size() < 2) {
+    return;
+  }
+
+  // validate files concurrently, schemas are compiled once and shared
+  atomic<size_t> next(0);
+  auto worker = [&]() {
+    for (size_t index = next++; index < pending.size(); index = next++) {
+      const auto& [file, schemaFile] = pending[index];
+      ProjMgrYamlSchemaChecker checker;
+      const auto time = RteFsUtils::GetModificationTime(file);
+      const bool result = checker.ValidateFile(file, schemaFile);
+      lock_guard<mutex> lock(theSchemaCheckerMutex);
+      thePrevalidationResults[file] = { time, result, checker.GetErrors() };
+    }
+  };
+  const size_t threadCount = min<size_t>(max(thread::hardware_concurrency(), 1U), pending.size());
+  vector<thread> threads;
+  for (size_t i = 1; i < threadCount; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& t : threads) {
+    t.join();
+  }
+}
+
+void ProjMgrYamlSchemaChecker::ClearPrevalidation()
+{
+  lock_guard<mutex> lock(theSchemaCheckerMutex);
+  thePrevalidationResults.clear();
+}
 
 bool ProjMgrYamlSchemaChecker::Validate(const std::string& file)
 {
@@ -30,12 +91,29 @@ bool ProjMgrYamlSchemaChecker::Validate(const std::string& file)
   }
 
   ClearErrors();
-  // Validate schema
-  bool result = ValidateFile(file, schemaFile);
+  bool result = false;
+  bool prevalidated = false;
+  {
+    // consume the result of a concurrent prevalidation if the file is unchanged
+    lock_guard<mutex> lock(theSchemaCheckerMutex);
+    const auto it = thePrevalidationResults.find(file);
+    if (it != thePrevalidationResults.end()) {
+      if (it->second.time == RteFsUtils::GetModificationTime(file)) {
+        result = it->second.result;
+        m_errors = it->second.errors;
+        prevalidated = true;
+      }
+      thePrevalidationResults.erase(it);
+    }
+  }
+  if (!prevalidated) {
+    // Validate schema
+    result = ValidateFile(file, schemaFile);
+  }
   for (auto& err : GetErrors()) {
     ProjMgrLogger::Get().Error(err.m_msg, "", err.m_file, err.m_line, err.m_col);
   }
-    return result;
+  return result;
 }
 
 std::string ProjMgrYamlSchemaChecker::FindSchema(const std::string& file) const
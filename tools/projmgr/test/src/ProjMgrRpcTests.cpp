@@ -15,10 +15,141 @@
 #include "RteFsUtils.h"
 #include "yaml-cpp/yaml.h"
 
+#include <condition_variable>
 #include <fstream>
 
 using namespace std;
 
+// client side of the rpc streams:
+// - in lockstep mode a request is only read by the server once all previous requests are answered,
+//   like a client waiting for each response, otherwise all requests are read at once
+// - with holdProgress the first progress report blocks until all requests are read,
+//   so these requests arrive while the reporting request is running
+class RpcClientStreams {
+public:
+  RpcClientStreams(const string& requests, bool lockstep, bool holdProgress = false);
+  ~RpcClientStreams();
+  string GetOutString();
+
+protected:
+  class InBuf : public streambuf {
+  public:
+    InBuf(RpcClientStreams& client) : m_client(client) {}
+  protected:
+    int underflow() override;
+    RpcClientStreams& m_client;
+    string m_current;
+  };
+  class OutBuf : public streambuf {
+  public:
+    OutBuf(RpcClientStreams& client) : m_client(client) {}
+  protected:
+    int overflow(int c) override;
+    streamsize xsputn(const char* s, streamsize n) override;
+    RpcClientStreams& m_client;
+  };
+
+  void Received(void);
+
+  InBuf m_in;
+  OutBuf m_out;
+  streambuf* m_cinBuf;
+  streambuf* m_coutBuf;
+  mutex m_mutex;
+  condition_variable m_cv;
+  vector<string> m_requests;
+  size_t m_next = 0;
+  size_t m_expected = 0;
+  size_t m_answered = 0;
+  bool m_lockstep;
+  bool m_holdProgress;
+  bool m_inputEnd = false;
+  string m_output;
+  size_t m_parsed = 0;
+};
+
+// maximum time to wait for the server, a failing server must not block the tests
+static constexpr chrono::seconds RPC_CLIENT_TIMEOUT(60);
+
+RpcClientStreams::RpcClientStreams(const string& requests, bool lockstep, bool holdProgress) :
+  m_in(*this), m_out(*this),
+  m_cinBuf(cin.rdbuf(&m_in)), m_coutBuf(cout.rdbuf(&m_out)),
+  m_lockstep(lockstep), m_holdProgress(holdProgress) {
+  // split concatenated requests at balanced braces
+  int braces = 0;
+  size_t start = 0;
+  for(size_t i = 0; i < requests.size(); i++) {
+    if(requests[i] == '{' && braces++ == 0) {
+      start = i;
+    } else if(requests[i] == '}' && --braces == 0) {
+      m_requests.push_back(requests.substr(start, i - start + 1));
+    }
+  }
+}
+
+RpcClientStreams::~RpcClientStreams() {
+  cin.rdbuf(m_cinBuf);
+  cout.rdbuf(m_coutBuf);
+}
+
+string RpcClientStreams::GetOutString() {
+  lock_guard<mutex> lock(m_mutex);
+  return m_output;
+}
+
+int RpcClientStreams::InBuf::underflow() {
+  unique_lock<mutex> lock(m_client.m_mutex);
+  if(m_client.m_next == m_client.m_requests.size()) {
+    m_client.m_inputEnd = true;
+    m_client.m_cv.notify_all();
+    return traits_type::eof();
+  }
+  if(m_client.m_lockstep) {
+    m_client.m_cv.wait_for(lock, RPC_CLIENT_TIMEOUT, [&]() { return m_client.m_answered >= m_client.m_expected; });
+  }
+  m_current = m_client.m_requests[m_client.m_next++];
+  // notifications are not answered
+  const json& request = json::parse(m_current, nullptr, false);
+  if(!request.is_object() || request.contains("id") || !request.contains("method")) {
+    m_client.m_expected++;
+  }
+  setg(m_current.data(), m_current.data(), m_current.data() + m_current.size());
+  return traits_type::to_int_type(*gptr());
+}
+
+int RpcClientStreams::OutBuf::overflow(int c) {
+  if(c != traits_type::eof()) {
+    const char ch = traits_type::to_char_type(c);
+    xsputn(&ch, 1);
+  }
+  return c;
+}
+
+streamsize RpcClientStreams::OutBuf::xsputn(const char* s, streamsize n) {
+  {
+    lock_guard<mutex> lock(m_client.m_mutex);
+    m_client.m_output.append(s, (size_t)n);
+  }
+  m_client.Received();
+  return n;
+}
+
+void RpcClientStreams::Received(void) {
+  unique_lock<mutex> lock(m_mutex);
+  for(size_t end = m_output.find('\n', m_parsed); end != string::npos; end = m_output.find('\n', m_parsed)) {
+    const json& message = json::parse(m_output.substr(m_parsed, end - m_parsed), nullptr, false);
+    m_parsed = end + 1;
+    if(message.is_object() && !message.contains("method")) {
+      m_answered++;
+      m_cv.notify_all();
+    } else if(m_holdProgress && message.is_object() && message["method"] == "$/progress" &&
+      message["params"]["value"]["kind"] == "report") {
+      m_holdProgress = false;
+      m_cv.wait_for(lock, RPC_CLIENT_TIMEOUT, [&]() { return m_inputEnd; });
+    }
+  }
+}
+
 auto find_item_by_id(json& items, const std::string& id) {
     return find_item(items, [&](const auto& item) { return item["id"] == id; });
 }
@@ -29,6 +160,8 @@ protected:
   virtual ~ProjMgrRpcTests() {}
   string FormatRequest(const int id, const string& method, const json& params);
   vector<json> RunRpcMethods(const string& strIn);
+  vector<json> RunRpcMethodsLockstep(const string& strIn, const vector<string>& options = {});
+  vector<json> ParseResponses(const string& output);
   string RunRpcMethodsWithContent(const string& strIn);
 
   string CreateLoadRequests(const string& solution,
@@ -125,6 +258,28 @@ vector<json> ProjMgrRpcTests::RunRpcMethods(const string& strIn) {
   return responses;
 }
 
+vector<json> ProjMgrRpcTests::RunRpcMethodsLockstep(const string& strIn, const vector<string>& options) {
+  // each request is only read once all previous requests are answered
+  RpcClientStreams client(strIn, true);
+  vector<char*> argv = {(char*)"csolution", (char*)"rpc"};
+  for(const auto& option : options) {
+    argv.push_back((char*)option.c_str());
+  }
+  EXPECT_EQ(0, RunProjMgr((int)argv.size(), argv.data(), m_envp));
+  m_id = 0;
+  return ParseResponses(client.GetOutString());
+}
+
+vector<json> ProjMgrRpcTests::ParseResponses(const string& output) {
+  string line;
+  vector<json> responses;
+  istringstream iss(output);
+  while(getline(iss, line)) {
+    responses.push_back(json::parse(line));
+  }
+  return responses;
+}
+
 string ProjMgrRpcTests::RunRpcMethodsWithContent(const string& strIn) {
   StdStreamRedirect streamRedirect;
   streamRedirect.SetInString(strIn);
@@ -149,6 +304,27 @@ TEST_F(ProjMgrRpcTests, ContentLength) {
   EXPECT_EQ(request, parsedRequest);
 }
 
+TEST_F(ProjMgrRpcTests, ContentLengthMultipleRequests) {
+  StdStreamRedirect streamRedirect;
+  ProjMgrRpcServer server(*this);
+  const auto& request = FormatRequest(1, "GetVersion");
+  // request larger than the transport read block
+  const auto& largeRequest = FormatRequest(2, "LoadSolution", json({{ "solution", string(100000, 'x') }}));
+
+  streamRedirect.SetInString("Content-Length:46\r\n\r\n" + request +
+    "Content-Type: application/vscode-jsonrpc; charset=utf-8\r\nContent-Length: " + to_string(largeRequest.size()) + "\r\n\r\n" + largeRequest +
+    "Content-Length:46\n\n" + request.substr(0, 20));
+  EXPECT_EQ(request, server.GetRequestFromStdinWithLength());
+  EXPECT_EQ(largeRequest, server.GetRequestFromStdinWithLength());
+  // incomplete request
+  EXPECT_EQ("", server.GetRequestFromStdinWithLength());
+
+  streamRedirect.SetInString(" " + request + "\n" + largeRequest + "\n");
+  EXPECT_EQ(request, server.GetRequestFromStdin());
+  EXPECT_EQ(largeRequest, server.GetRequestFromStdin());
+  EXPECT_EQ("", server.GetRequestFromStdin());
+}
+
 TEST_F(ProjMgrRpcTests, RpcGetVersion) {
   const auto& requests = FormatRequest(1, "GetVersion");
   const auto& responses = RunRpcMethods(requests);
@@ -173,6 +349,118 @@ TEST_F(ProjMgrRpcTests, RpcLoadPacks) {
   EXPECT_TRUE(responses[1]["result"]["success"]);
 }
 
+TEST_F(ProjMgrRpcTests, RpcCancelRequest) {
+  auto csolutionPath = testinput_folder + "/TestRpc/minimal.csolution.yml";
+  auto cancel = [](int id) {
+    json cancelRequest;
+    cancelRequest["jsonrpc"] = "2.0";
+    cancelRequest["method"] = "$/cancelRequest";
+    cancelRequest["params"]["id"] = id;
+    return cancelRequest.dump();
+  };
+  // LoadPacks is held in its first progress report until all requests are read:
+  // LoadSolution and GetPacksInfo are queued, GetLogMessages waits for the earlier requests
+  const auto requests =
+    FormatRequest(1, "LoadPacks", json({{ "workDoneToken", "packs" }})) +
+    FormatRequest(2, "LoadSolution", json({{ "solution", csolutionPath }, { "activeTarget", "TestHW" }})) +
+    FormatRequest(3, "GetPacksInfo", json({{ "context", "minimal+TestHW" }, { "all", false }})) +
+    cancel(3) + cancel(1) + cancel(99) +
+    FormatRequest(4, "GetLogMessages");
+  RpcClientStreams client(requests, false, true);
+  char* argv[] = {(char*)"csolution", (char*)"rpc", (char*)"--progress-rate", (char*)"0"};
+  EXPECT_EQ(0, RunProjMgr(4, argv, m_envp));
+
+  // cancel notifications have no response
+  map<int, json> responses;
+  unsigned int percentage = 0;
+  for(const auto& message : ParseResponses(client.GetOutString())) {
+    if(message.contains("id")) {
+      responses[message["id"]] = message;
+    } else if(message["params"]["value"]["kind"] == "report") {
+      percentage = message["params"]["value"]["percentage"];
+    }
+  }
+  ASSERT_EQ(4, responses.size());
+  // running LoadPacks stops after the first pack
+  EXPECT_EQ(-32800, responses[1]["error"]["code"]);
+  EXPECT_GT(100, percentage);
+  EXPECT_TRUE(responses[2]["result"]["success"]);
+  // queued GetPacksInfo is removed
+  EXPECT_EQ(-32800, responses[3]["error"]["code"]);
+  EXPECT_TRUE(responses[4]["result"]["success"]);
+}
+
+TEST_F(ProjMgrRpcTests, RpcGetLogMessagesAfterPendingRequests) {
+  auto csolutionPath = testinput_folder + "/TestRpc/minimal.csolution.yml";
+  // LoadPacks is held in its first progress report until all requests are read,
+  // GetLogMessages and GetVariables arrive while LoadPacks is running and LoadSolution is queued
+  const auto requests =
+    FormatRequest(1, "LoadPacks", json({{ "workDoneToken", "packs" }})) +
+    FormatRequest(2, "LoadSolution", json({{ "solution", csolutionPath }, { "activeTarget", "TestHW" }})) +
+    FormatRequest(3, "GetLogMessages") +
+    FormatRequest(4, "GetVariables", json({{ "context", "minimal+TestHW" }})) +
+    FormatRequest(5, "GetVersion");
+  RpcClientStreams client(requests, false, true);
+  char* argv[] = {(char*)"csolution", (char*)"rpc", (char*)"--progress-rate", (char*)"0"};
+  EXPECT_EQ(0, RunProjMgr(4, argv, m_envp));
+
+  vector<int> ids;
+  map<int, json> responses;
+  for(const auto& message : ParseResponses(client.GetOutString())) {
+    if(message.contains("id")) {
+      ids.push_back(message["id"]);
+      responses[message["id"]] = message;
+    }
+  }
+  ASSERT_EQ(5, responses.size());
+  // GetVersion is answered immediately, the queries wait for the loaded solution
+  EXPECT_EQ(5, ids.front());
+  EXPECT_EQ(vector<int>({ 1, 2, 3, 4 }), vector<int>(ids.begin() + 1, ids.end()));
+  EXPECT_TRUE(responses[2]["result"]["success"]);
+  EXPECT_TRUE(responses[3]["result"]["success"]);
+  EXPECT_TRUE(responses[4]["result"]["success"]);
+}
+
+TEST_F(ProjMgrRpcTests, RpcProgress) {
+  auto csolutionPath = testinput_folder + "/TestRpc/minimal.csolution.yml";
+  const auto requests =
+    FormatRequest(1, "LoadPacks", json({{ "workDoneToken", "packs" }})) +
+    FormatRequest(2, "LoadSolution", json({{ "solution", csolutionPath }, { "activeTarget", "TestHW" }}));
+  const auto& responses = RunRpcMethodsLockstep(requests, { "--progress-rate", "0" });
+
+  // progress notifications precede the response of the request carrying the token
+  ASSERT_LE(4, responses.size());
+  const auto& response = responses[responses.size() - 2];
+  EXPECT_EQ(1, response["id"]);
+  EXPECT_TRUE(response["result"]["success"]);
+  EXPECT_EQ(2, responses.back()["id"]);
+  for(size_t i = 0; i < responses.size() - 2; i++) {
+    EXPECT_EQ("$/progress", responses[i]["method"]);
+    EXPECT_EQ("packs", responses[i]["params"]["token"]);
+  }
+  EXPECT_EQ("begin", responses.front()["params"]["value"]["kind"]);
+  EXPECT_EQ("LoadPacks", responses.front()["params"]["value"]["title"]);
+  EXPECT_EQ("report", responses[1]["params"]["value"]["kind"]);
+  EXPECT_EQ("loading packs", responses[1]["params"]["value"]["message"]);
+  EXPECT_EQ(0, responses[1]["params"]["value"]["percentage"]);
+  EXPECT_EQ("end", responses[responses.size() - 3]["params"]["value"]["kind"]);
+
+  // one report per loaded pack with increasing percentage
+  RteKernelSlim rteKernel;
+  rteKernel.SetCmsisPackRoot(testcmsispack_folder);
+  list<string> pdscFiles;
+  rteKernel.GetEffectivePdscFiles(pdscFiles, false);
+  ASSERT_EQ(pdscFiles.size() + 5, responses.size());
+  unsigned int percentage = 0;
+  for(size_t i = 2; i < responses.size() - 3; i++) {
+    const auto& value = responses[i]["params"]["value"];
+    EXPECT_EQ("report", value["kind"]);
+    EXPECT_EQ(0, value["message"].get<string>().find("loading packs: "));
+    EXPECT_LT(percentage, value["percentage"].get<unsigned int>());
+    percentage = value["percentage"];
+  }
+  EXPECT_EQ(100, percentage);
+}
 
 TEST_F(ProjMgrRpcTests, RpcLoadSolution) {
   const auto& requests = CreateLoadRequests("/TestRpc/minimal.csolution.yml", "TestHW");
@@ -592,6 +880,64 @@ TEST_F(ProjMgrRpcTests, RpcValidateComponents) {
   EXPECT_EQ("ARM::RteTest:Dependency:Variant", incompat["conditions"][0]["aggregates"][0]);
 }
 
+TEST_F(ProjMgrRpcTests, RpcValidateComponentsDelta) {
+  string context = "mixed-issues+CM0";
+  vector<string> contextList = {
+    context
+  };
+  json param;
+  param["context"] = context;
+  param["id"] = "ARM::RteTest:ApiExclusive:S2";
+  param["count"] = 0;
+  param["options"] = json::object();
+
+  auto validate = [&](size_t revision) {
+    return json({ { "context", context }, { "revision", revision } });
+  };
+  auto requests = CreateLoadRequests("/Validation/dependencies.csolution.yml", "", contextList);
+  requests += FormatRequest(3, "ValidateComponentsDelta", validate(0));
+  requests += FormatRequest(4, "ValidateComponentsDelta", validate(1));
+  requests += FormatRequest(5, "SelectComponent", param);
+  requests += FormatRequest(6, "ValidateComponentsDelta", validate(2));
+  requests += FormatRequest(7, "ValidateComponentsDelta", validate(1));
+
+  const auto& responses = RunRpcMethods(requests);
+
+  // all results
+  auto results = responses[2]["result"];
+  EXPECT_TRUE(results["success"]);
+  EXPECT_EQ(results["revision"], 1);
+  EXPECT_FALSE(results["delta"]);
+  EXPECT_FALSE(results.contains("changed"));
+  EXPECT_EQ(results["result"], "INCOMPATIBLE_VARIANT");
+  EXPECT_EQ(results["validation"].size(), 2);
+
+  // nothing changed
+  results = responses[3]["result"];
+  EXPECT_EQ(results["revision"], 2);
+  EXPECT_TRUE(results["delta"]);
+  EXPECT_TRUE(results["changed"].empty());
+  EXPECT_TRUE(results["validation"].empty());
+
+  // deselecting a component removes the API conflict, the incompatible variant is unchanged
+  EXPECT_TRUE(responses[4]["result"]["success"]);
+  results = responses[5]["result"];
+  EXPECT_EQ(results["revision"], 3);
+  EXPECT_TRUE(results["delta"]);
+  EXPECT_EQ(results["result"], "INCOMPATIBLE_VARIANT");
+  auto changed = results["changed"].get<vector<string>>();
+  EXPECT_TRUE(find(changed.begin(), changed.end(), "RteTest:ApiExclusive@1.0.0") != changed.end());
+  EXPECT_TRUE(find(changed.begin(), changed.end(), "ARM::RteTest:Check:IncompatibleVariant@0.9.9") == changed.end());
+  EXPECT_TRUE(results["validation"].empty());
+
+  // outdated revision: all results
+  results = responses[6]["result"];
+  EXPECT_EQ(results["revision"], 4);
+  EXPECT_FALSE(results["delta"]);
+  ASSERT_EQ(results["validation"].size(), 1);
+  EXPECT_EQ(results["validation"][0]["id"], "ARM::RteTest:Check:IncompatibleVariant@0.9.9");
+}
+
 TEST_F(ProjMgrRpcTests, RpcResolveComponents) {
   string context = "selectable+CM0";
   vector<string> contextList = {
@@ -642,6 +988,77 @@ TEST_F(ProjMgrRpcTests, RpcGetComponentsTree) {
   EXPECT_EQ(size3, size6); // after solution reload, all components can be requested
 }
 
+TEST_F(ProjMgrRpcTests, RpcGetComponentsTreeView) {
+  string context = "selectable+CM0";
+  vector<string> contextList = {
+    context
+  };
+  json param;
+  param["context"] = context;
+  param["id"] = "ARM::RteTest:CORE";
+  param["count"] = 1;
+  param["options"] = json::object();
+
+  auto view = [&](const json& v) {
+    return json({ { "context", context }, { "all", false }, { "view", v } });
+  };
+  auto requests = CreateLoadRequests("/Validation/dependencies.csolution.yml", "", contextList);
+  requests += FormatRequest(3, "GetComponentsTreeView", view(json::object()));
+  requests += FormatRequest(4, "GetComponentsTreeView", view({ { "revision", 1 } }));
+  requests += FormatRequest(5, "SelectComponent", param);
+  requests += FormatRequest(6, "GetComponentsTreeView", view({ { "revision", 1 } }));
+  requests += FormatRequest(7, "GetComponentsTreeView", view({ { "depth", 1 } }));
+  requests += FormatRequest(8, "GetComponentsTreeView", view({ { "path", json::array({ "Unknown" }) } }));
+  requests += FormatRequest(9, "GetComponentsTreeView", view({ { "revision", "1" } }));
+  requests += FormatRequest(10, "GetComponentsTreeView", view({ { "path", json::array({ "RteTest" }) }, { "depth", 0 } }));
+
+  const auto& responses = RunRpcMethods(requests);
+
+  // full tree with revision
+  auto tree = responses[2]["result"];
+  EXPECT_TRUE(tree["success"]);
+  EXPECT_EQ(tree["revision"], 1);
+  EXPECT_FALSE(tree["delta"]);
+  EXPECT_FALSE(tree.contains("collapsed"));
+  ASSERT_TRUE(tree["classes"].size() > 1);
+  string className = tree["classes"][1]["name"];
+  EXPECT_EQ(tree["classes"][1]["result"], "SELECTABLE");
+
+  // nothing changed
+  auto delta = responses[3]["result"];
+  EXPECT_TRUE(delta["delta"]);
+  EXPECT_EQ(delta["revision"], 1);
+  EXPECT_TRUE(delta["classes"].empty());
+
+  // selection resolves the dependency of the class, only classes with selected components have changed
+  delta = responses[5]["result"];
+  EXPECT_TRUE(delta["delta"]);
+  EXPECT_EQ(delta["revision"], 2);
+  EXPECT_LT(delta["classes"].size(), tree["classes"].size());
+  auto changed = find_item(delta["classes"], [&](const auto& item) { return item["name"] == className; });
+  ASSERT_TRUE(!!changed);
+  EXPECT_FALSE(changed->get().contains("result"));
+  EXPECT_FALSE(changed->get()["bundles"].empty());
+
+  // classes only, their bundles are collapsed
+  auto classes = responses[6]["result"]["classes"];
+  EXPECT_EQ(classes.size(), tree["classes"].size());
+  for(const auto& c : classes) {
+    EXPECT_TRUE(c["bundles"].empty());
+  }
+  EXPECT_EQ(responses[6]["result"]["collapsed"].size(), classes.size());
+
+  // unknown path and invalid revision
+  EXPECT_EQ(responses[7]["error"]["code"], -11);
+  EXPECT_EQ(responses[8]["error"]["code"], -32602);
+
+  // single collapsed class
+  classes = responses[9]["result"]["classes"];
+  ASSERT_EQ(classes.size(), 1);
+  EXPECT_EQ(classes[0]["name"], "RteTest");
+  EXPECT_TRUE(classes[0]["bundles"].empty());
+  EXPECT_EQ(responses[9]["result"]["collapsed"], json::array({ json::array({ "RteTest" }) }));
+}
 
 TEST_F(ProjMgrRpcTests, RpcSelectComponent) {
   string context = "selectable+CM0";
@@ -646,3 +646,15 @@ TEST_F(ProjMgrSchemaCheckerUnitTests, SchemaCheck_CbuildRun) {
         EXPECT_TRUE(errList.end() != errItr);
     }
 }
+
+TEST_F(ProjMgrSchemaCheckerUnitTests, SchemaCheck_FindSchema_Retry) {
+  // a schema added after a failed search is found, a removed one is no longer reported
+  const string& filename = testinput_folder + "/TestProject/test.cretry.yml";
+  const string& schemaFile = etc_folder + "/cretry.schema.json";
+  RteFsUtils::RemoveFile(schemaFile);
+  EXPECT_TRUE(FindSchema(filename).empty());
+  RteFsUtils::CopyFileExAutoRetry(etc_folder + "/cproject.schema.json", schemaFile);
+  EXPECT_TRUE(RteFsUtils::Equivalent(schemaFile, FindSchema(filename)));
+  RteFsUtils::RemoveFile(schemaFile);
+  EXPECT_TRUE(FindSchema(filename).empty());
+}
@@ -486,6 +486,39 @@ TEST_F(ProjMgrUnitTests, ListPacks_ProjectAndLayer) {
   EXPECT_EQ(outStr, expected);
 }
 
+TEST_F(ProjMgrUnitTests, ListPacks_PackCache) {
+  char* argv[6];
+  StdStreamRedirect streamRedirect;
+  const string& csolution = testinput_folder + "/TestLayers/packs.csolution.yml";
+  const string& cacheDir = testcmsispack_folder + "/.Local/.cache";
+  const string& indexFile = testcmsispack_folder + "/.Local/installed_packs.idx";
+  RteFsUtils::RemoveDir(cacheDir);
+  RteFsUtils::RemoveFile(indexFile);
+
+  // cache is not written by default
+  argv[1] = (char*)"list";
+  argv[2] = (char*)"packs";
+  argv[3] = (char*)"--solution";
+  argv[4] = (char*)csolution.c_str();
+  EXPECT_EQ(0, RunProjMgr(5, argv, 0));
+  EXPECT_FALSE(RteFsUtils::Exists(cacheDir));
+  EXPECT_FALSE(RteFsUtils::Exists(indexFile));
+  streamRedirect.ClearStringStreams();
+
+  // opt-in writes the cache, the second run reads it with the same output
+  argv[5] = (char*)"--pack-cache";
+  EXPECT_EQ(0, RunProjMgr(6, argv, 0));
+  EXPECT_TRUE(RteFsUtils::Exists(indexFile));
+  EXPECT_GT(RteFsUtils::CountFilesInFolder(cacheDir), 0);
+  const string expected = streamRedirect.GetOutString();
+  streamRedirect.ClearStringStreams();
+  EXPECT_EQ(0, RunProjMgr(6, argv, 0));
+  EXPECT_EQ(streamRedirect.GetOutString(), expected);
+
+  RteFsUtils::RemoveDir(cacheDir);
+  RteFsUtils::RemoveFile(indexFile);
+}
+
 TEST_F(ProjMgrUnitTests, ListPacks_Path) {
   char* argv[6];
   StdStreamRedirect streamRedirect;
@@ -911,6 +944,116 @@ TEST_F(ProjMgrUnitTests, RunProjMgrSolution) {
     testinput_folder + "/TestSolution/ref/test.cbuild-pack.yml");
 }
 
+TEST_F(ProjMgrUnitTests, RunProjMgrSolution_Jobs) {
+  char* argv[9];
+
+  // convert --solution solution.yml --jobs 4
+  const string& csolution = testinput_folder + "/TestSolution/test.csolution.yml";
+  // the reference cbuild-idx.yml expects newly generated files
+  RteFsUtils::RemoveFile(testinput_folder + "/TestSolution/test.cbuild-pack.yml");
+  RteFsUtils::RemoveDir(testoutput_folder);
+  argv[1] = (char*)"convert";
+  argv[2] = (char*)"--solution";
+  argv[3] = (char*)csolution.c_str();
+  argv[4] = (char*)"-o";
+  argv[5] = (char*)testoutput_folder.c_str();
+  argv[6] = (char*)"--cbuildgen";
+  argv[7] = (char*)"--jobs";
+  argv[8] = (char*)"4";
+  EXPECT_EQ(0, RunProjMgr(9, argv, m_envp));
+
+  // Parallel processing must produce the same results as the sequential one
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test1.Debug+CM0.cprj",
+    testinput_folder + "/TestSolution/ref/test1.Debug+CM0.cprj");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test1.Release+CM0.cprj",
+    testinput_folder + "/TestSolution/ref/test1.Release+CM0.cprj");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test2.Debug+CM0.cprj",
+    testinput_folder + "/TestSolution/ref/test2.Debug+CM0.cprj");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test2.Debug+CM3.cprj",
+    testinput_folder + "/TestSolution/ref/test2.Debug+CM3.cprj");
+
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test.cbuild-idx.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test.cbuild-idx.yml");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test1.Debug+CM0.cbuild.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test1.Debug+CM0.cbuild.yml");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test1.Release+CM0.cbuild.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test1.Release+CM0.cbuild.yml");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test2.Debug+CM0.cbuild.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test2.Debug+CM0.cbuild.yml");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test2.Debug+CM3.cbuild.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test2.Debug+CM3.cbuild.yml");
+}
+
+TEST_F(ProjMgrUnitTests, RunProjMgrSolution_Incremental) {
+  char* argv[9];
+
+  // convert --solution solution.yml --incremental
+  const string& csolution = testinput_folder + "/TestSolution/test.csolution.yml";
+  argv[1] = (char*)"convert";
+  argv[2] = (char*)"--solution";
+  argv[3] = (char*)csolution.c_str();
+  argv[4] = (char*)"-o";
+  argv[5] = (char*)testoutput_folder.c_str();
+  argv[6] = (char*)"--cbuildgen";
+  argv[7] = (char*)"--verbose";
+  argv[8] = (char*)"--incremental";
+  EXPECT_EQ(0, RunProjMgr(9, argv, m_envp));
+
+  const string& fingerprint = testoutput_folder + "/test1.Debug+CM0.fingerprint.yml";
+  EXPECT_TRUE(RteFsUtils::Exists(fingerprint));
+  const auto timestamp = RteFsUtils::GetModificationTime(fingerprint);
+
+  // Unchanged contexts are skipped, their fingerprints and generated files are kept
+  StdStreamRedirect streamRedirect;
+  EXPECT_EQ(0, RunProjMgr(9, argv, m_envp));
+  EXPECT_EQ(timestamp, RteFsUtils::GetModificationTime(fingerprint));
+  const string& cbuild = testoutput_folder + "/test1.Debug+CM0.cbuild.yml";
+  EXPECT_NE(streamRedirect.GetOutString().find(cbuild + " - info csolution: file is already up-to-date"), string::npos);
+
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test1.Debug+CM0.cprj",
+    testinput_folder + "/TestSolution/ref/test1.Debug+CM0.cprj");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test1.Debug+CM0.cbuild.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test1.Debug+CM0.cbuild.yml");
+  ProjMgrTestEnv::CompareFile(testoutput_folder + "/test2.Debug+CM3.cbuild.yml",
+    testinput_folder + "/TestSolution/ref/cbuild/test2.Debug+CM3.cbuild.yml");
+}
+
+TEST_F(ProjMgrUnitTests, RunProjMgrSolution_Incremental_OutputDirs) {
+  char* argv[8];
+
+  // convert --solution solution.yml --incremental with output directories depending on the context
+  const string& csolution = testinput_folder + "/TestSolution/incremental.csolution.yml";
+  argv[1] = (char*)"convert";
+  argv[2] = (char*)"--solution";
+  argv[3] = (char*)csolution.c_str();
+  argv[4] = (char*)"-o";
+  argv[5] = (char*)testoutput_folder.c_str();
+  argv[6] = (char*)"--verbose";
+  argv[7] = (char*)"--incremental";
+  EXPECT_EQ(0, RunProjMgr(8, argv, m_envp));
+
+  const string& fingerprint = testoutput_folder + "/out/test2/CM3/test2.Debug+CM3.fingerprint.yml";
+  EXPECT_TRUE(RteFsUtils::Exists(fingerprint));
+  const auto timestamp = RteFsUtils::GetModificationTime(fingerprint);
+
+  // A stale cbuild-pack entry does not invalidate the contexts and is removed
+  const string& cbuildPack = testinput_folder + "/TestSolution/incremental.cbuild-pack.yml";
+  string cbuildPackContent, staleContent;
+  ASSERT_TRUE(RteFsUtils::ReadFile(cbuildPack, cbuildPackContent));
+  staleContent = cbuildPackContent + "    - resolved-pack: ARM::RteTest_Stale@1.0.0\n";
+  ASSERT_TRUE(RteFsUtils::CopyBufferToFile(cbuildPack, staleContent, false));
+
+  // Unchanged contexts are found in their expanded output directories and skipped
+  StdStreamRedirect streamRedirect;
+  EXPECT_EQ(0, RunProjMgr(8, argv, m_envp));
+  EXPECT_EQ(timestamp, RteFsUtils::GetModificationTime(fingerprint));
+  const string& cbuild = testoutput_folder + "/out/test2/CM0/test2.Debug+CM0.cbuild.yml";
+  EXPECT_NE(streamRedirect.GetOutString().find(cbuild + " - info csolution: file is already up-to-date"), string::npos);
+  string content;
+  EXPECT_TRUE(RteFsUtils::ReadFile(cbuildPack, content));
+  EXPECT_EQ(cbuildPackContent, content);
+}
+
 TEST_F(ProjMgrUnitTests, RunProjMgrSolution_PositionalArguments) {
   char* argv[6];
   const string& csolution = testinput_folder + "/TestSolution/test.csolution.yml";
@@ -7813,6 +7956,28 @@ TEST_F(ProjMgrUnitTests, ParseCommandLine_MutualExclusionOptions) {
   EXPECT_NE(string::npos, errStr.find("error csolution: command line options '--quiet' and '--verbose' are mutually exclusive"));
 }
 
+TEST_F(ProjMgrUnitTests, ParseCommandLine_Jobs) {
+  const string csolution = testinput_folder + "/TestSolution/test.csolution.yml";
+  char* argv[6];
+  argv[1] = (char*)"convert";
+  argv[2] = (char*)"--solution";
+  argv[3] = (char*)csolution.c_str();
+
+  // default: sequential processing
+  EXPECT_EQ(0, ParseCommandLine(4, argv));
+  EXPECT_EQ(1U, m_worker.GetJobs());
+
+  argv[4] = (char*)"--jobs";
+  argv[5] = (char*)"4";
+  EXPECT_EQ(0, ParseCommandLine(6, argv));
+  EXPECT_EQ(4U, m_worker.GetJobs());
+
+  argv[4] = (char*)"-j";
+  argv[5] = (char*)"0";
+  EXPECT_EQ(0, ParseCommandLine(6, argv));
+  EXPECT_EQ(0U, m_worker.GetJobs());
+}
+
 TEST_F(ProjMgrUnitTests, GenerateMLOps) {
   char* argv[5];
   string csolution = testinput_folder + "/MLOps/minimal.csolution.yml";
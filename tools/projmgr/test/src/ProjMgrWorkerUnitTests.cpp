@@ -1057,6 +1057,54 @@ TEST_F(ProjMgrWorkerUnitTests, GetAllCombinations) {
   }
 }
 
+TEST_F(ProjMgrWorkerUnitTests, VisitCombinations) {
+  const string strBoardA = "BoardA.clayer.yml";
+  const string strBoardB = "BoardB.clayer.yml";
+  const string strBoardC = "BoardC.clayer.yml";
+  const string strProject = "Project.cproject.yml";
+  const string strShieldA = "ShieldA.clayer.yml";
+  const string strShieldB = "ShieldB.clayer.yml";
+  ConnectItem providedAnanas1 = { "A", RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, {{"Ananas", "1"}}, StrPairVec() };
+  ConnectItem providedAnanas2 = { "B", RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, {{"Ananas", "2"}}, StrPairVec() };
+  ConnectItem providedBanana  = { "C", RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, {{"Banana", ""}}, StrPairVec() };
+  ConnectItem consumedAnanas1 = { "P", RteUtils::EMPTY_STRING, RteUtils::EMPTY_STRING, StrPairVec(), {{"Ananas", "1"}} };
+
+  ConnectionsCollectionMap connections = {
+    {"Board",   {{ strBoardA, "Board", {&providedAnanas1} },
+                 { strBoardB, "Board", {&providedAnanas2} },
+                 { strBoardC, "Board", {&providedBanana } }}},
+    {"Project", {{ strProject, RteUtils::EMPTY_STRING, {&consumedAnanas1} }}},
+    {"Shield",  {{ strShieldA, "Shield" },
+                 { strShieldB, "Shield" }}},
+  };
+
+  // without pruning every combination is visited
+  int visited = 0;
+  StrVec valid;
+  VisitCombinations(connections, false, [&](const ConnectionsCollectionVec& combination) {
+    visited++;
+    if (ValidateConnections(combination).valid) {
+      valid.push_back(combination.front().filename + " " + combination.back().filename);
+    }
+  });
+  EXPECT_EQ(6, visited);
+  const StrVec expected = { "BoardA.clayer.yml ShieldA.clayer.yml", "BoardA.clayer.yml ShieldB.clayer.yml" };
+  EXPECT_EQ(expected, valid);
+
+  // partial combinations are discarded before combining the 'Shield' column:
+  // BoardB provides a value the project does not consume, BoardC provides a connection no column consumes
+  visited = 0;
+  valid.clear();
+  VisitCombinations(connections, true, [&](const ConnectionsCollectionVec& combination) {
+    visited++;
+    if (ValidateConnections(combination).valid) {
+      valid.push_back(combination.front().filename + " " + combination.back().filename);
+    }
+  });
+  EXPECT_EQ(2, visited);
+  EXPECT_EQ(expected, valid);
+}
+
 TEST_F(ProjMgrWorkerUnitTests, GetAllSelectCombinations) {
   ConnectItem connectA = { "A" };
   ConnectItem connectB = { "B" };
@@ -33,6 +33,73 @@ TEST_F(ProjMgrYamlParserUnitTests, ParseCbuildSet) {
   EXPECT_FALSE(ParseCbuildSet("unkownfile.cbuild-set.yml", buildSetItem, true));
 }
 
+TEST_F(ProjMgrYamlParserUnitTests, ParseGenericClayers) {
+  const string& layersDir = testoutput_folder + "/GenericClayers";
+  RteFsUtils::CopyTree(testinput_folder + "/TestLayers/variables", layersDir);
+  const vector<string> clayers = {
+    layersDir + "/target1.clayer.yml",
+    layersDir + "/target2.clayer.yml",
+    layersDir + "/target3.clayer.yml",
+  };
+  ProjMgrParser parser;
+  EXPECT_TRUE(parser.ParseGenericClayers(clayers, true));
+  for (const auto& clayer : clayers) {
+    ASSERT_EQ(1, parser.GetGenericClayers().count(clayer));
+    EXPECT_EQ("Board", parser.GetGenericClayers().at(clayer).type);
+  }
+
+  // modified file is parsed again, unchanged files are reused
+  string content;
+  RteFsUtils::ReadFile(clayers[1], content);
+  RteUtils::ReplaceAll(content, "type: Board", "type: Shield");
+  RteFsUtils::CopyBufferToFile(clayers[1], content, false);
+  fs::last_write_time(clayers[1], fs::last_write_time(clayers[1]) + chrono::seconds(1));
+  ProjMgrParser parserModified;
+  EXPECT_TRUE(parserModified.ParseGenericClayers(clayers, true));
+  EXPECT_EQ("Board", parserModified.GetGenericClayers().at(clayers[0]).type);
+  EXPECT_EQ("Shield", parserModified.GetGenericClayers().at(clayers[1]).type);
+  EXPECT_EQ("Board", parserModified.GetGenericClayers().at(clayers[2]).type);
+
+  // parsing stops at the first invalid file
+  const string& invalid = testinput_folder + "/TestLayers/unknown.clayer.yml";
+  ProjMgrParser parserInvalid;
+  EXPECT_FALSE(parserInvalid.ParseGenericClayers({ clayers[0], invalid, clayers[2] }, false));
+  EXPECT_EQ(1, parserInvalid.GetGenericClayers().count(clayers[0]));
+  EXPECT_EQ(0, parserInvalid.GetGenericClayers().count(clayers[2]));
+}
+
+TEST_F(ProjMgrYamlParserUnitTests, ParsedItemCache) {
+  const string& clayer = testoutput_folder + "/ParsedItemCache/cached.clayer.yml";
+  RteFsUtils::CreateTextFile(clayer, "layer:\n  type: Board\n");
+  ProjMgrParser parser;
+  EXPECT_TRUE(parser.ParseClayer(clayer, false));
+  EXPECT_EQ("Board", parser.GetClayers().at(clayer).type);
+
+  // file rewritten with the same content is reused, changed content is parsed again
+  const auto time = fs::last_write_time(clayer);
+  RteFsUtils::CreateTextFile(clayer, "layer:\n  type: Board\n");
+  fs::last_write_time(clayer, time + chrono::seconds(1));
+  ProjMgrParser parserRewritten;
+  EXPECT_TRUE(parserRewritten.ParseClayer(clayer, false));
+  EXPECT_EQ("Board", parserRewritten.GetClayers().at(clayer).type);
+  RteFsUtils::CreateTextFile(clayer, "layer:\n  type: Other\n");
+  fs::last_write_time(clayer, time + chrono::seconds(2));
+  ProjMgrParser parserModified;
+  EXPECT_TRUE(parserModified.ParseClayer(clayer, false));
+  EXPECT_EQ("Other", parserModified.GetClayers().at(clayer).type);
+
+  // change keeping size and modification time is only seen after invalidating the file
+  RteFsUtils::CreateTextFile(clayer, "layer:\n  type: Board\n");
+  fs::last_write_time(clayer, time + chrono::seconds(2));
+  ProjMgrParser parserCached;
+  EXPECT_TRUE(parserCached.ParseClayer(clayer, false));
+  EXPECT_EQ("Other", parserCached.GetClayers().at(clayer).type);
+  ProjMgrParser::InvalidateCache(clayer);
+  ProjMgrParser parserInvalidated;
+  EXPECT_TRUE(parserInvalidated.ParseClayer(clayer, false));
+  EXPECT_EQ("Board", parserInvalidated.GetClayers().at(clayer).type);
+}
+
 TEST_F(ProjMgrYamlParserUnitTests, ValidateCbuildSet) {
   string cbuildSetFile = testinput_folder + "/TestSolution/invalid_keys_test.cbuild-set.yml";
   YAML::Node root = YAML::LoadFile(cbuildSetFile);